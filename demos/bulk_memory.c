@@ -0,0 +1,249 @@
+/*
+
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          bulk_memory.c
+DEMO WRITTEN BY:    mukid (hum)
+CREATION DATE:      2026-10-17
+LAST UPDATED:       2026-10-17
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to copy, fill, and compare blocks of 
+memory, including blocks that overlap and blocks that cross 
+over from static memory into dynamic memory.
+
+============================================================
+
+============================================================
+                        LICENSE INFO
+
+All code is licensed under MIT License or public domain, 
+whichever you prefer.
+More explicit license information at the end of file.
+
+============================================================
+
+*/
+
+#define MUB_IMPLEMENTATION
+#include "muBytecode.h"
+
+#include <stdio.h>
+
+// bytecode function to print all the static and dynamic memory
+void bytecode_print_mem(muContext* context) {
+    printf("-----------------------------------\n");
+    printf("Static memory: \n");
+    for (size_m i = 0; i < context->static_memory_len; i++) {
+        printf("%02X ", context->static_memory[i]);
+        if ((i+1) % 8 == 0 && i != 0) {
+            printf("\n");
+        }
+    }
+    printf("Dynamic memory: \n");
+    for (size_m i = 0; i < context->dynamic_memory_len; i++) {
+        printf("%02X ", context->dynamic_memory[i]);
+        if ((i+1) % 8 == 0 && i != 0) {
+            printf("\n");
+        }
+    }
+}
+
+int main() {
+    // Bytecode for the program:
+    muByte bytecode[] = {
+        /* BEGINNING HEADER */
+
+        // file signature
+        'm', 'u', 'b', 0,
+        // bit-widths        version major version minor version patch
+        mu_binary(00000000), 1,            0,            0,
+        // static memory allocation bytes
+        0, 0, 0, 16,
+        // temp memory allocation bytes
+        0, 0, 0, 16,
+
+        /* declare 'print_mem' external function */
+
+        // external function command  id  name
+        0x12,                         0,  'p', 'r', 'i', 'n', 't', '_', 'm', 'e', 'm', '\0',
+
+        // main function (function ID 0x00)
+
+        0xE0, 0,
+
+            /* increase dynamic memory to 16 bytes, which starts right after static memory at address 16 */
+
+            // dynamic mem size set command  data type            byte size  new dynamic memory byte size
+            0x02,                            mu_binary(01000000), 0, 1,      16,
+
+            /* move the 4 bytes "ABCD" to address 0x01 */
+
+            // move
+            0x80,
+            // src data type     size  bytes
+            mu_binary(00000000), 0, 4, 'A', 'B', 'C', 'D',
+            // dst data type     size  address
+            mu_binary(00000000), 0, 4, 0x01,
+
+            /* copy the 4 bytes at address 0x01 to address 0x03 */
+            // the two blocks overlap, but the copy acts as if the source was read in full before anything was
+            // written, so address 0x01 should now hold "ABABCD"
+
+            // copy command  length data type     byte size  length
+            0x03,            mu_binary(01000000), 0, 1,      4,
+            // src data type     size  address  dst data type        size  address
+            mu_binary(00000000), 0, 1, 0x01,    mu_binary(00000000), 0, 1, 0x03,
+
+            /* print memory, should have "ABABCD" (41 42 41 42 43 44) at address 0x01 */
+
+            // execute ext. func. command  data type of id      byte size of id  id
+            0xE4,                          mu_binary(01000000), 0, 1,            0,
+
+            /* fill the 4 bytes starting at address 14 with 0xAA */
+            // this crosses over from the last 2 bytes of static memory into the first 2 bytes of dynamic memory
+
+            // fill command  length/value data type  byte size  length  value
+            0x04,            mu_binary(01000000),    0, 1,      4,      0xAA,
+            // dst data type     size  address
+            mu_binary(00000000), 0, 1, 14,
+
+            /* fill the 4 bytes starting at address 26 (10 bytes into dynamic memory) with 0xAA as well */
+
+            // fill command  length/value data type  byte size  length  value
+            0x04,            mu_binary(01000000),    0, 1,      4,      0xAA,
+            // dst data type     size  address
+            mu_binary(00000000), 0, 1, 16 + 10,
+
+            /* print memory, should have 0xAA at the end of static memory and in 2 spots in dynamic memory */
+
+            // execute ext. func. command  data type of id      byte size of id  id
+            0xE4,                          mu_binary(01000000), 0, 1,            0,
+
+            /* compare the 4 bytes at address 14 with the 4 bytes at address 26, storing the result at address 0x08 */
+
+            // compare command  length data type     byte size  length
+            0x05,               mu_binary(01000000), 0, 1,      4,
+            // address data type size  address 0  address 1
+            mu_binary(00000000), 0, 1, 14,        16 + 10,
+            // dst data type     size  address
+            mu_binary(11000000), 0, 1, 0x08,
+
+            /* print the result of the comparison, which should be 0, since both blocks are the same */
+
+            // print command  data type             byte size  address  print spec (integer)
+            0x01,             mu_binary(11000001),  0, 1,      0x08,    mu_binary(00000000),
+            // print command  data type             byte size  char  print spec (character)
+            0x01,             mu_binary(11000000),  0, 1,      '\n', mu_binary(10000000),
+
+            /* change the last byte of the first block, which is in dynamic memory, to 0x01 */
+
+            // move command  source data type     byte size  value  destination data type  byte size  address
+            0x80,            mu_binary(01000000), 0, 1,      0x01,  mu_binary(01000000),   0, 1,      16 + 1,
+
+            /* compare the same blocks again */
+
+            // compare command  length data type     byte size  length
+            0x05,               mu_binary(01000000), 0, 1,      4,
+            // address data type size  address 0  address 1
+            mu_binary(00000000), 0, 1, 14,        16 + 10,
+            // dst data type     size  address
+            mu_binary(11000000), 0, 1, 0x08,
+
+            /* print the result of the comparison, which should be -1, since 0x01 is ordered before 0xAA */
+
+            // print command  data type             byte size  address  print spec (integer)
+            0x01,             mu_binary(11000001),  0, 1,      0x08,    mu_binary(00000000),
+            // print command  data type             byte size  char  print spec (character)
+            0x01,             mu_binary(11000000),  0, 1,      '\n', mu_binary(10000000),
+
+            /* try to fill the 8 bytes starting at address 28 */
+            // only 4 bytes of dynamic memory are left at that address, so this prints a warning and execution fails
+
+            // fill command  length/value data type  byte size  length  value
+            0x04,            mu_binary(01000000),    0, 1,      8,      0xFF,
+            // dst data type     size  address
+            mu_binary(00000000), 0, 1, 16 + 12,
+
+            /* return 0, which is never reached */
+
+            // return command  data type             byte size  return value
+            0x00,              mu_binary(01000000),  0, 1,      0,
+
+        0xE1,
+
+        /* END HEADER */
+
+        'e', 'n', 'd', mu_binary(11111111),
+    };
+
+    // create context with bytecode
+    muContext context = mu_context_create(MU_NULL_PTR, bytecode, sizeof(bytecode), MU_TRUE);
+
+    // set external function named "print_mem" in bytecode to 'bytecode_print_mem'
+    mu_context_set_external_function(MU_NULL_PTR, &context, "print_mem", bytecode_print_mem);
+
+    // execute main function, which should fail
+    muResult result = MU_SUCCESS;
+    mu_context_execute_main(&result, &context);
+    if (result == MU_SUCCESS) {
+        printf("Execution succeeded.\n");
+    } else {
+        printf("Execution failed.\n");
+    }
+
+    // print memory to show that the failed fill didn't change anything
+    bytecode_print_mem(&context);
+
+    // destroy context
+    context = mu_context_destroy(MU_NULL_PTR, context);
+
+    // print end bar to make look nice
+    printf("-----------------------------------\n");
+
+    return 0;
+}
+
+/*
+This software is available under 2 licenses -- choose whichever you prefer.
+
+## ALTERNATIVE A - MIT License
+Copyright (c) 2023 Hum
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+
+## ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
@@ -104,6 +104,7 @@ More explicit license information at the end of the file.
 #endif
 
 #if !defined(mu_malloc)  || \
+    !defined(mu_calloc)  || \
     !defined(mu_free)    || \
     !defined(mu_realloc)
 
@@ -113,6 +114,10 @@ More explicit license information at the end of the file.
     	#define mu_malloc malloc
     #endif
 
+    #ifndef mu_calloc
+    	#define mu_calloc calloc
+    #endif
+
     #ifndef mu_free
     	#define mu_free free
     #endif
@@ -123,8 +128,10 @@ More explicit license information at the end of the file.
 
 #endif
 
-#if !defined(mu_memset) || \
-	!defined(mu_memcpy) || \
+#if !defined(mu_memset)  || \
+	!defined(mu_memcpy)  || \
+	!defined(mu_memmove) || \
+	!defined(mu_memcmp)  || \
 	!defined(mu_strcmp)
 
 	#include <string.h>
@@ -137,6 +144,14 @@ More explicit license information at the end of the file.
 		#define mu_memcpy memcpy
 	#endif
 
+	#ifndef mu_memmove
+		#define mu_memmove memmove
+	#endif
+
+	#ifndef mu_memcmp
+		#define mu_memcmp memcmp
+	#endif
+
 	#ifndef mu_strcmp
 		#define mu_strcmp strcmp
 	#endif
@@ -229,21 +244,32 @@ More explicit license information at the end of the file.
 
 /* structs */
 
+// functions that everything belonging to a program or context is allocated with, each given user_data;
+// reallocate is also given the current size of the memory, and is given MU_NULL_PTR with a size of 0 to allocate
+struct muAllocator {
+	void* (*allocate)(void* user_data, size_m size);
+	void* (*reallocate)(void* user_data, void* memory, size_m old_size, size_m new_size);
+	void (*deallocate)(void* user_data, void* memory);
+	void* user_data;
+};
+typedef struct muAllocator muAllocator;
+
 struct muJumpMarker {
 	size_m bytecode_index;
+	size_m instruction_index;
 	size_m index;
 };
 typedef struct muJumpMarker muJumpMarker;
 
 struct muFunction {
 	size_m bytecode_index;
+	size_m instruction_index;
 	size_m index;
 	char* name;
 };
 typedef struct muFunction muFunction;
 
 struct muExternalFunction {
-	void (*function)(void* context);
 	size_m index;
 	char* name;
 };
@@ -258,6 +284,132 @@ struct mubDataType {
 };
 typedef struct mubDataType mubDataType;
 
+// maps IDs to array indexes in constant time; a plain array indexed by ID when the IDs are dense
+// enough, otherwise an open-addressed hash table
+struct mubIdTable {
+	// array index + 1 for each slot, 0 if the slot is empty
+	size_m* slots;
+	// ID held by each slot, only used when hashed
+	uint64_m* ids;
+	size_m slot_len;
+};
+typedef struct mubIdTable mubIdTable;
+
+// maps names to array indexes
+struct mubNameTable {
+	// array index + 1 for each slot, 0 if the slot is empty
+	size_m* slots;
+	// hash and name held by each slot
+	uint64_m* hashes;
+	const char** names;
+	size_m slot_len;
+};
+typedef struct mubNameTable mubNameTable;
+
+// a function name found while scanning the bytecode, before its function is known
+struct mubFunctionName {
+	uint64_m id;
+	char* name;
+};
+typedef struct mubFunctionName mubFunctionName;
+
+// instructions of a lazily created program decoded together the first time one of them is reached;
+// function declarations split the code into ranges
+struct mubLazyRange {
+	size_m begin;
+	size_m end;
+	// bytecode index of the command at begin
+	size_m bytecode_index;
+	// MUB_RANGE_*, only accessed atomically
+	long state;
+};
+typedef struct mubLazyRange mubLazyRange;
+
+// bookkeeping for scanning the commands of a program being created, not needed once it's created
+struct mubProgramScan {
+	muBool lazy;
+	// whether a command ran into the end header, after which nothing more is decoded
+	muBool code_overrun;
+	// function names can come before the function they name, so they're matched once every function is known
+	mubFunctionName* function_names;
+	size_m function_name_len;
+	size_m function_name_capacity;
+	size_m instruction_capacity;
+	size_m jump_marker_capacity;
+	size_m function_capacity;
+	size_m external_function_capacity;
+	size_m variable_capacity;
+	size_m lazy_range_capacity;
+};
+typedef struct mubProgramScan mubProgramScan;
+
+// beginning of a program image; images are only loadable by builds with the same layout
+struct mubImageHeader {
+	muByte signature[4];
+	uint32_m version;
+	// native representation of 0x01020304, to catch images from a different byte order
+	uint32_m byte_order;
+	uint16_m size_m_size;
+	uint16_m instruction_size;
+	uint16_m function_size;
+	uint16_m external_function_size;
+	uint16_m jump_marker_size;
+	uint16_m variable_size;
+};
+typedef struct mubImageHeader mubImageHeader;
+
+// an operand as it appears after a command, decoded once when the program is created
+struct mubOperand {
+	mubDataType datatype;
+	// address to dereference (or store at, for destinations), already in native byte order
+	uint64_m address;
+	// raw value if it isn't dereferenced and fits in 8 bytes, otherwise found at bytecode_index
+	muByte immediate[8];
+	size_m bytecode_index;
+};
+typedef struct mubOperand mubOperand;
+
+// performs an operation on the values in the registers and stores the result at mem_loc
+typedef void (*mubOperationKernel)(muByte* mem_loc, muByte* reg0, muByte* reg1);
+
+// values of up to 8 bytes are held inline, bigger ones (struct moves) in a spill buffer allocated when the context is created
+struct mubRegister {
+	union {
+		uint64_m u64;
+		double f64;
+		muByte bytes[8];
+	} value;
+	size_m spill_len;
+	muByte* spill;
+};
+typedef struct mubRegister mubRegister;
+
+// a single decoded command
+struct mubInstruction {
+	muByte command;
+	// what the instruction is dispatched to when executed (MUB_HANDLER_*)
+	muByte handler;
+	size_m bytecode_index;
+	// index of the instruction executed after this one
+	size_m next;
+	// index of the instruction executed instead if this is a conditional that gets skipped
+	size_m skip;
+	// jump marker/function/external function ID, if the command has one
+	uint64_m id;
+	// instruction index of the called function if known when the program is created, otherwise instruction_len;
+	// for lazy entries, the range they lead into
+	size_m target;
+	mubOperand src0;
+	mubOperand src1;
+	// the second address of a compare, which shares the data type of the first
+	mubOperand src2;
+	mubOperand dst;
+	muByte spec;
+	// operation between the source and destination types, 0 if the command has none or the conversion is invalid
+	mubOperationKernel kernel;
+};
+typedef struct mubInstruction mubInstruction;
+
 struct muVariable {
 	size_m address;
 	mubDataType datatype;
@@ -265,13 +417,20 @@ struct muVariable {
 };
 typedef struct muVariable muVariable;
 
-struct muContext {
+// the decoded, read-only part of some bytecode, which any number of contexts can execute at once
+struct muProgram {
 	muBool alive;
+	// what the program and everything within it is allocated with
+	muAllocator allocator;
 	muByte* bytecode;
 	size_m bytecode_len;
-	int32_m main_return;
+	// whether bytecode is a copy freed along with the program, or the caller's buffer
+	muBool owns_bytecode;
+	// whether bytecode is a file mapping unmapped along with the program
+	muBool mapped_bytecode;
 
-	muResult last_if;
+	mubInstruction* instructions;
+	size_m instruction_len;
 
 	muFunction* functions;
 	size_m function_len;
@@ -285,33 +444,136 @@ struct muContext {
 	size_m jump_marker_len;
 	size_m jump_marker_id_byte_len;
 
+	mubIdTable function_table;
+	mubIdTable external_function_table;
+	mubIdTable jump_marker_table;
+
+	mubNameTable function_name_table;
+	mubNameTable external_function_name_table;
+	mubNameTable variable_name_table;
+
 	muVariable* variables;
 	size_m variable_len;
 
 	muByte bytewidth;
 
+	size_m static_memory_len;
+	size_m temp_memory_len;
+
+	// size of the register spill buffers needed to execute the program
+	size_m reg0_spill_len;
+	size_m reg1_spill_len;
+
+	// null unless the program was created lazily
+	mubLazyRange* lazy_ranges;
+	size_m lazy_range_len;
+};
+typedef struct muProgram muProgram;
+
+// a program being created from bytecode that arrives in chunks
+struct muLoader {
+	muBool alive;
+	muBool fail_if_invalid_bytecode;
+	// whether the beginning header has arrived and been read
+	muBool begun;
+	// whether the end header has been scanned
+	muBool finished;
+	size_m bytecode_capacity;
+	// bytecode index of the first command that hasn't been scanned yet
+	size_m scan_index;
+	mubProgramScan scan;
+	// holds the bytecode received so far and everything scanned from it
+	muProgram program;
+};
+typedef struct muLoader muLoader;
+
+// the state of one execution of a program
+struct muContext {
+	muBool alive;
+	// what the context's memory and state is allocated with, not necessarily the same as its program's
+	muAllocator allocator;
+	muProgram* program;
+	// whether the program was created along with the context, and is destroyed along with it
+	muBool owns_program;
+	int32_m main_return;
+
+	muResult last_if;
+
+	// function associated with each of the program's external functions
+	void (**external_functions)(void* context);
+
 	size_m static_memory_len;
 	muByte* static_memory;
+	// whether static memory is an anonymous mapping rather than allocated
+	muBool static_memory_mapped;
 
 	size_m temp_memory_len;
 	muByte* temp_memory;
+	// whether temporary memory is an anonymous mapping rather than allocated
+	muBool temp_memory_mapped;
 
 	size_m dynamic_memory_len;
+	// bytes allocated for dynamic memory, which can be more than its length
+	size_m dynamic_memory_capacity;
 	muByte* dynamic_memory;
 
+	// with MUB_FLAT_MEMORY, the one allocation holding temporary, static, and dynamic memory in that order, which the
+	// other memory pointers point into
+	muByte* memory;
+	// whether memory is an anonymous mapping rather than allocated
+	muBool memory_mapped;
+	// where static memory starts in memory; right after temporary memory unless it's guarded
+	size_m static_memory_offset;
+	// with MUB_GUARD_PAGE_MEMORY, the length of the reservation memory starts, or 0 if it isn't guarded
+	size_m memory_reserved;
+
 	// reg0 is memory for virtually anything
-	size_m reg0_len;
-	muByte* reg0;
-	// reg1 is almost exclusively for holding memory addresses
-	size_m reg1_len;
-	muByte* reg1;
-	// reg2 also
-	size_m reg2_len;
-	muByte* reg2;
+	mubRegister reg0;
+	// reg1 holds the second source of three operand instructions
+	mubRegister reg1;
+
+	// instruction to return to for each function call being executed
+	size_m* frames;
+	size_m frame_len;
+	size_m frame_capacity;
 };
 typedef struct muContext muContext;
 #define muContext muContext
 
+// an external function name and the function to associate with it
+struct muExternalFunctionBinding {
+	const char* name;
+	void (*function)(muContext* context);
+};
+typedef struct muExternalFunctionBinding muExternalFunctionBinding;
+
+// pooled contexts are kept a cache line apart so that threads executing neighbouring contexts don't contend
+struct mubPooledContext {
+	muContext context;
+	// whether the context is acquired, so that releasing it twice or without acquiring it can be caught; only accessed
+	// atomically
+	long in_use;
+	muByte padding[64];
+};
+typedef struct mubPooledContext mubPooledContext;
+
+// contexts of one program ready to be handed out, shared between threads without locking
+struct muContextPool {
+	muBool alive;
+	muProgram* program;
+	// what the pool and every context in it are allocated with
+	muAllocator allocator;
+	mubPooledContext* contexts;
+	size_m context_len;
+	// index + 1 of the context after each free context, 0 for the last one; only accessed atomically
+	long* next;
+	// index + 1 of the first free context in the low 32 bits, and the amount of acquires in the high 32 bits so that a
+	// context acquired and released again between another thread's read and swap can't be mistaken for no change;
+	// only accessed atomically
+	int64_m head;
+};
+typedef struct muContextPool muContextPool;
+
 /* binary/bit/byte handling */
 
 #define mu_binary(b) mu_string_to_binary(#b)
@@ -326,9 +588,43 @@ typedef struct muContext muContext;
 
 /* functions */
 
+// program
+MUDEF muProgram mu_program_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muProgram mu_program_create_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muProgram mu_program_create_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muProgram mu_program_create_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muProgram mu_program_create_lazy(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muProgram mu_program_create_lazy_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muProgram mu_program_create_lazy_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muProgram mu_program_create_lazy_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muProgram mu_program_create_from_file(muResult* result, const char* filename, muBool fail_if_invalid_bytecode);
+MUDEF muProgram mu_program_create_from_file_with_allocator(muResult* result, const char* filename, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muProgram mu_program_create_from_image(muResult* result, muByte* image, size_m image_len);
+MUDEF muProgram mu_program_create_from_image_with_allocator(muResult* result, muByte* image, size_m image_len, const muAllocator* allocator);
+MUDEF muProgram mu_program_destroy(muResult* result, muProgram program);
+MUDEF size_m mu_program_write_image(muResult* result, muProgram* program, muByte* image, size_m image_len);
+
+// loader
+MUDEF muLoader mu_loader_create(muResult* result, muBool fail_if_invalid_bytecode);
+MUDEF muLoader mu_loader_create_with_allocator(muResult* result, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muLoader mu_loader_destroy(muResult* result, muLoader loader);
+MUDEF muBool mu_loader_feed(muResult* result, muLoader* loader, muByte* chunk, size_m chunk_len);
+MUDEF muProgram mu_program_create_from_loader(muResult* result, muLoader* loader);
+
 // context
 MUDEF muContext mu_context_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muContext mu_context_create_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muContext mu_context_create_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode);
+MUDEF muContext mu_context_create_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muContext mu_context_create_from_file(muResult* result, const char* filename, muBool fail_if_invalid_bytecode);
+MUDEF muContext mu_context_create_from_file_with_allocator(muResult* result, const char* filename, muBool fail_if_invalid_bytecode, const muAllocator* allocator);
+MUDEF muContext mu_context_create_from_image(muResult* result, muByte* image, size_m image_len);
+MUDEF muContext mu_context_create_from_image_with_allocator(muResult* result, muByte* image, size_m image_len, const muAllocator* allocator);
+MUDEF muContext mu_context_create_from_loader(muResult* result, muLoader* loader);
+MUDEF muContext mu_context_create_from_program(muResult* result, muProgram* program);
+MUDEF muContext mu_context_create_from_program_with_allocator(muResult* result, muProgram* program, const muAllocator* allocator);
 MUDEF muContext mu_context_destroy(muResult* result, muContext context);
+MUDEF void mu_context_reset(muResult* result, muContext* context);
 
 MUDEF int mu_context_execute_main(muResult* result, muContext* context);
 MUDEF void mu_context_execute_function(muResult* result, muContext* context, size_m id);
@@ -340,6 +636,15 @@ MUDEF void mu_context_get_variable_data(muResult* result, muContext* context, mu
 MUDEF void mu_context_set_variable_data(muResult* result, muContext* context, muVariable variable, void* data);
 
 MUDEF void mu_context_set_external_function(muResult* result, muContext* context, const char* name, void(*function)(muContext* context));
+MUDEF size_m mu_context_set_external_functions(muResult* result, muContext* context, const muExternalFunctionBinding* bindings, size_m binding_len);
+
+// context pool
+MUDEF muContextPool mu_context_pool_create(muResult* result, muProgram* program, size_m context_len);
+MUDEF muContextPool mu_context_pool_create_with_allocator(muResult* result, muProgram* program, size_m context_len, const muAllocator* allocator);
+MUDEF muContextPool mu_context_pool_destroy(muResult* result, muContextPool pool);
+MUDEF size_m mu_context_pool_set_external_functions(muResult* result, muContextPool* pool, const muExternalFunctionBinding* bindings, size_m binding_len);
+MUDEF muContext* mu_context_pool_acquire(muResult* result, muContextPool* pool);
+MUDEF void mu_context_pool_release(muResult* result, muContextPool* pool, muContext* context);
 
 // binary/bit/byte handling
 MUDEF muByte mu_string_to_binary(const char* s);
@@ -400,14 +705,8 @@ int64_m mu_get_int64_from_bytecode(muByte* bytecode) {
 	return (*(int64_m*)&static_memory_len_bytes[0]);
 }
 
-muResult mu_bytecode_check_header_validity(muByte* bytecode, size_m bytecode_len) {
-	// length check
-	if (bytecode_len < MU_BEGINNING_HEADER_LENGTH + MU_END_HEADER_LENGTH) {
-		mu_print("[MUB] Failed to create context; bytecode is invalid length.\n");
-		return MU_FAILURE;
-	}
-
-	/* BEGINNING HEADER INFO */
+// only needs the first MU_BEGINNING_HEADER_LENGTH bytes of the bytecode
+muResult mub_check_beginning_header(muByte* bytecode) {
 
 	// file signature check
 	if (
@@ -429,6 +728,22 @@ muResult mu_bytecode_check_header_validity(muByte* bytecode, size_m bytecode_len
 		mu_print("[MUB] WARNING! mub version specified in bytecode does not match with the version of this interpreter. Bytecode may not execute properly.\n");
 	}
 
+	return MU_SUCCESS;
+}
+
+muResult mu_bytecode_check_header_validity(muByte* bytecode, size_m bytecode_len) {
+	// length check
+	if (bytecode_len < MU_BEGINNING_HEADER_LENGTH + MU_END_HEADER_LENGTH) {
+		mu_print("[MUB] Failed to create context; bytecode is invalid length.\n");
+		return MU_FAILURE;
+	}
+
+	/* BEGINNING HEADER INFO */
+
+	if (mub_check_beginning_header(bytecode) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+
 	// end header
 	if (
 		bytecode[bytecode_len-4] != mu_binary(01100101) ||
@@ -450,7 +765,7 @@ muResult mu_bytecode_check_header_validity(muByte* bytecode, size_m bytecode_len
 #define MUB_DATA_TYPE_INTEGER 2
 #define MUB_DATA_TYPE_DECIMAL 3
 
-muResult mub_perform_operation(muContext* context, mubDataType src0_dt, mubDataType src1_dt, mubDataType dst_dt, int operation, int64_m reg1_val, int64_m reg2_val);
+mubOperationKernel mub_get_operation_kernel(int operation, mubDataType src_dt, mubDataType dst_dt);
 
 mubDataType mu_get_data_type_from_bytecode(muByte* bytecode) {
 	mubDataType dt = {0};
@@ -489,13518 +804,4378 @@ mubDataType mu_get_data_type_from_bytecode(muByte* bytecode) {
 #define MUB_OPERATION_COND_GREATER       16
 #define MUB_OPERATION_COND_GREATER_EQUAL 17
 
-// registers
+#define MUB_HANDLER_UNKNOWN                  0
+#define MUB_HANDLER_END_OF_CODE              1
+#define MUB_HANDLER_NEXT                     2
+#define MUB_HANDLER_RETURN_MAIN              3
+#define MUB_HANDLER_PRINT                    4
+#define MUB_HANDLER_SET_DYNAMIC_BUFFER_SIZE  5
+#define MUB_HANDLER_COPY                     6
+#define MUB_HANDLER_FILL                     7
+#define MUB_HANDLER_COMPARE                  8
+#define MUB_HANDLER_MOVE                     9
+#define MUB_HANDLER_ADD                     10
+#define MUB_HANDLER_SUBTRACT                11
+#define MUB_HANDLER_MULTIPLY                12
+#define MUB_HANDLER_DIVIDE                  13
+#define MUB_HANDLER_MODULO                  14
+#define MUB_HANDLER_BW_NOT                  15
+#define MUB_HANDLER_BW_AND                  16
+#define MUB_HANDLER_BW_OR                   17
+#define MUB_HANDLER_BW_XOR                  18
+#define MUB_HANDLER_BW_LSHIFT               19
+#define MUB_HANDLER_BW_RSHIFT               20
+#define MUB_HANDLER_COND_EQUAL              21
+#define MUB_HANDLER_COND_NOT_EQUAL          22
+#define MUB_HANDLER_COND_LESS               23
+#define MUB_HANDLER_COND_LESS_EQUAL         24
+#define MUB_HANDLER_COND_GREATER            25
+#define MUB_HANDLER_COND_GREATER_EQUAL      26
+#define MUB_HANDLER_IF                      27
+#define MUB_HANDLER_END_FUNCTION            28
+#define MUB_HANDLER_RETURN                  29
+#define MUB_HANDLER_CALL_FUNCTION           30
+#define MUB_HANDLER_CALL_EXTERNAL_FUNCTION  31
+// function declarations and jump markers of lazy programs, which decode the range they lead into
+#define MUB_HANDLER_LAZY_ENTRY              32
+// instructions of verified functions whose operands are constant and always within memory, see mub_verify_function
+#define MUB_HANDLER_VERIFIED_OPERATION      33
+#define MUB_HANDLER_VERIFIED_IF             34
+#define MUB_HANDLER_COUNT                   35
+
+#ifndef MUB_MAX_CALL_DEPTH
+	#define MUB_MAX_CALL_DEPTH 65536
+#endif
 
-uint64_m mu_context_get_reg_pointer_value(muByte* reg, size_m reg_len) {
-	switch (reg_len) {
-	default:
-		return 0;
-		break;
-	case 1:
-		return mu_get_uint8_from_bytecode(reg);
-		break;
-	case 2:
-		return mu_get_uint16_from_bytecode(reg);
-		break;
-	case 4:
-		return mu_get_uint32_from_bytecode(reg);
-		break;
-	case 8:
-		return mu_get_uint64_from_bytecode(reg);
-		break;
+// bytecode files are mapped instead of read where possible
+#if !defined(MUB_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+	#define MUB_MMAP
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+#include <stdio.h>
+
+// big static and temporary memory is mapped straight from zero pages, which cost nothing until they're touched
+#if defined(MUB_MMAP) && (defined(MAP_ANONYMOUS) || defined(MAP_ANON))
+	#define MUB_MMAP_MEMORY
+	#ifndef MAP_ANONYMOUS
+		#define MAP_ANONYMOUS MAP_ANON
+	#endif
+#endif
+#ifndef MUB_MMAP_MEMORY_THRESHOLD
+	#define MUB_MMAP_MEMORY_THRESHOLD 1048576
+#endif
+
+// guarded memory is laid out flat within a reservation, and needs signals and thread-local storage to catch faults
+#ifdef MUB_GUARD_PAGE_MEMORY
+	#if defined(MUB_MMAP_MEMORY) && defined(__GNUC__)
+		#ifndef MUB_FLAT_MEMORY
+			#define MUB_FLAT_MEMORY
+		#endif
+		#include <signal.h>
+		#include <setjmp.h>
+	#else
+		#undef MUB_GUARD_PAGE_MEMORY
+	#endif
+#endif
+
+// atomics, so that threads can share lazily decoded programs and context pools;
+// the plain versions work on longs and the 64 versions on int64_ms
+#if defined(__GNUC__)
+	#define MUB_ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+	#define MUB_ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+	#define MUB_ATOMIC_CAS(p, expected, desired) __sync_bool_compare_and_swap((p), (expected), (desired))
+	#define MUB_ATOMIC_LOAD64(p) MUB_ATOMIC_LOAD(p)
+	#define MUB_ATOMIC_STORE64(p, v) MUB_ATOMIC_STORE(p, v)
+	#define MUB_ATOMIC_CAS64(p, expected, desired) MUB_ATOMIC_CAS(p, expected, desired)
+#elif defined(_MSC_VER)
+	#include <intrin.h>
+	#define MUB_ATOMIC_LOAD(p) _InterlockedCompareExchange((p), 0, 0)
+	#define MUB_ATOMIC_STORE(p, v) _InterlockedExchange((p), (v))
+	#define MUB_ATOMIC_CAS(p, expected, desired) (_InterlockedCompareExchange((p), (desired), (expected)) == (expected))
+	#define MUB_ATOMIC_LOAD64(p) _InterlockedCompareExchange64((p), 0, 0)
+	#define MUB_ATOMIC_STORE64(p, v) _InterlockedExchange64((p), (v))
+	#define MUB_ATOMIC_CAS64(p, expected, desired) (_InterlockedCompareExchange64((p), (desired), (expected)) == (expected))
+#else
+	// lazily decoded programs and context pools can't be shared between threads without atomics
+	#define MUB_ATOMIC_LOAD(p) (*(p))
+	#define MUB_ATOMIC_STORE(p, v) (*(p) = (v))
+	#define MUB_ATOMIC_CAS(p, expected, desired) ((*(p) == (expected)) ? ((*(p) = (desired)), 1) : 0)
+	#define MUB_ATOMIC_LOAD64(p) MUB_ATOMIC_LOAD(p)
+	#define MUB_ATOMIC_STORE64(p, v) MUB_ATOMIC_STORE(p, v)
+	#define MUB_ATOMIC_CAS64(p, expected, desired) MUB_ATOMIC_CAS(p, expected, desired)
+#endif
+
+// lets other threads run while a thread waits on another; only a spin-wait hint where yielding needs bigger headers
+#if defined(__unix__) || defined(__APPLE__)
+	#include <sched.h>
+	#define MUB_YIELD() sched_yield()
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	#include <intrin.h>
+	#define MUB_YIELD() _mm_pause()
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+	#include <intrin.h>
+	#define MUB_YIELD() __yield()
+#else
+	#define MUB_YIELD()
+#endif
+
+#define MUB_RANGE_UNDECODED 0
+#define MUB_RANGE_DECODING  1
+#define MUB_RANGE_DECODED   2
+
+// GCC and Clang can jump straight from one handler to the next
+#if defined(__GNUC__) && !defined(MUB_NO_COMPUTED_GOTO)
+	#define MUB_COMPUTED_GOTO
+#endif
+
+// allocators
+
+void* mub_default_allocate(void* user_data, size_m size) {
+	(void)user_data;
+	return mu_malloc(size);
+}
+
+void* mub_default_reallocate(void* user_data, void* memory, size_m old_size, size_m new_size) {
+	(void)user_data;
+	(void)old_size;
+	return mu_realloc(memory, new_size);
+}
+
+void mub_default_deallocate(void* user_data, void* memory) {
+	(void)user_data;
+	mu_free(memory);
+}
+
+// used whenever no allocator is given
+const muAllocator mub_default_allocator = { mub_default_allocate, mub_default_reallocate, mub_default_deallocate, MU_NULL_PTR };
+
+muAllocator mub_get_allocator(const muAllocator* allocator) {
+	if (allocator == MU_NULL_PTR) {
+		return mub_default_allocator;
 	}
+	return *allocator;
 }
 
-int64_m mu_context_get_reg_pointer_signed_value(muByte* reg, size_m reg_len) {
-	switch (reg_len) {
-	default:
-		return 0;
-		break;
-	case 1:
-		return mu_get_int8_from_bytecode(reg);
-		break;
-	case 2:
-		return mu_get_int16_from_bytecode(reg);
-		break;
-	case 4:
-		return mu_get_int32_from_bytecode(reg);
-		break;
-	case 8:
-		return mu_get_int64_from_bytecode(reg);
-		break;
+muBool mub_is_default_allocator(const muAllocator* allocator) {
+	return (allocator->allocate == mub_default_allocate && allocator->reallocate == mub_default_reallocate && allocator->deallocate == mub_default_deallocate) ? MU_TRUE : MU_FALSE;
+}
+
+void* mub_allocate(const muAllocator* allocator, size_m size) {
+	return allocator->allocate(allocator->user_data, size);
+}
+
+void* mub_reallocate(const muAllocator* allocator, void* memory, size_m old_size, size_m new_size) {
+	return allocator->reallocate(allocator->user_data, memory, old_size, new_size);
+}
+
+// freeing nothing is a no-op, so objects that were never set up can be destroyed without an allocator
+void mub_deallocate(const muAllocator* allocator, void* memory) {
+	if (memory == MU_NULL_PTR) {
+		return;
 	}
+	allocator->deallocate(allocator->user_data, memory);
 }
 
-muByte* mu_context_get_memory_location(muContext* context, size_m index, int buffer) {
-	if (buffer == 0) {
-		if (index < context->static_memory_len) {
-			return &context->static_memory[index];
-		} else {
-			index -= context->static_memory_len;
-			if (index < context->dynamic_memory_len) {
-				return &context->dynamic_memory[index];
-			}
-			return MU_NULL_PTR;
-		}
+void* mub_allocate_zeroed(const muAllocator* allocator, size_m size) {
+	if (mub_is_default_allocator(allocator) == MU_TRUE) {
+		return mu_calloc(size, sizeof(muByte));
 	}
-	if (index < context->temp_memory_len) {
-		return &context->temp_memory[index];
+	void* memory = mub_allocate(allocator, size);
+	if (memory != MU_NULL_PTR) {
+		mu_memset(memory, 0, size);
 	}
-	return MU_NULL_PTR;
+	return memory;
 }
 
-muResult mu_context_fill_reg0_with_data_type(muContext* context, mubDataType dt, muByte* bytecode) {
-	if ((context->reg0 == MU_NULL_PTR) || (context->reg0_len < dt.byte_size)) {
-		if (context->reg0 != MU_NULL_PTR) {
-			mu_free(context->reg0);
-		}
-		context->reg0 = mu_malloc(dt.byte_size);
-		context->reg0_len = dt.byte_size;
+// zeroed memory for a context, without touching it; mapped is set to whether it needs to be unmapped rather than freed
+muByte* mub_allocate_zeroed_memory(const muAllocator* allocator, size_m len, muBool* mapped) {
+	*mapped = MU_FALSE;
+	if (len == 0) {
+		return MU_NULL_PTR;
 	}
-	if (dt.pointer_count == 0) {
-		mu_memcpy(context->reg0, bytecode, dt.byte_size);
-	} else {
-		if (context->reg0_len < context->bytewidth) {
-			context->reg0 = mu_realloc(context->reg0, context->bytewidth);
-			context->reg0_len = context->bytewidth;
-		}
-		mu_memcpy(context->reg0, bytecode, context->bytewidth);
-		while (dt.pointer_count > 0) {
-			if (dt.pointer_count != 1) {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg0, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg0, mem_loc, context->bytewidth);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			} else {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg0, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg0, mem_loc, dt.byte_size);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			}
-			if (
-				dt.pointer_count != 1 && 
-				(mu_context_get_reg_pointer_value(context->reg0, context->bytewidth) + context->bytewidth) > context->static_memory_len + context->dynamic_memory_len
-			) {
-				mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-				return MU_FAILURE;
-			}
-			dt.pointer_count--;
+
+	// other allocators are always used, as their memory may be expected to come from them
+	#ifdef MUB_MMAP_MEMORY
+	if (len >= MUB_MMAP_MEMORY_THRESHOLD && mub_is_default_allocator(allocator) == MU_TRUE) {
+		void* mapping = mmap(MU_NULL_PTR, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapping != MAP_FAILED) {
+			*mapped = MU_TRUE;
+			return (muByte*)mapping;
 		}
 	}
-	return MU_SUCCESS;
+	#endif
+
+	// calloc can skip zeroing memory it knows is already zero, which is usually the case for big allocations
+	return mub_allocate_zeroed(allocator, len);
 }
 
-muResult mu_context_fill_reg1_with_data_type(muContext* context, mubDataType dt, muByte* bytecode) {
-	if ((context->reg1 == MU_NULL_PTR) || (context->reg1_len < dt.byte_size)) {
-		if (context->reg1 != MU_NULL_PTR) {
-			mu_free(context->reg1);
-		}
-		context->reg1 = mu_malloc(dt.byte_size);
-		context->reg1_len = dt.byte_size;
+void mub_free_zeroed_memory(const muAllocator* allocator, muByte* memory, size_m len, muBool mapped) {
+	if (mapped == MU_TRUE) {
+		#ifdef MUB_MMAP_MEMORY
+		munmap(memory, len);
+		#endif
+		return;
 	}
-	if (dt.pointer_count == 0) {
-		mu_memcpy(context->reg1, bytecode, dt.byte_size);
-	} else {
-		if (context->reg1_len < context->bytewidth) {
-			context->reg1 = mu_realloc(context->reg1, context->bytewidth);
-			context->reg1_len = context->bytewidth;
-		}
-		mu_memcpy(context->reg1, bytecode, context->bytewidth);
-		while (dt.pointer_count > 0) {
-			if (dt.pointer_count != 1) {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg1, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg1, mem_loc, context->bytewidth);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			} else {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg1, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg1, mem_loc, dt.byte_size);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			}
-			if (
-				dt.pointer_count != 1 && 
-				(mu_context_get_reg_pointer_value(context->reg1, context->bytewidth) + context->bytewidth) > context->static_memory_len + context->dynamic_memory_len
-			) {
-				mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-				return MU_FAILURE;
-			}
-			dt.pointer_count--;
+	#ifndef MUB_MMAP_MEMORY
+	(void)len;
+	#endif
+	mub_deallocate(allocator, memory);
+}
+
+// zeroes memory from mub_allocate_zeroed_memory, giving mapped pages back so that it costs nothing until touched again
+void mub_clear_zeroed_memory(muByte* memory, size_m len, muBool mapped) {
+	#ifdef MUB_MMAP_MEMORY
+	if (mapped == MU_TRUE) {
+		#if defined(__linux__) && defined(MADV_DONTNEED)
+		// private anonymous pages read as zero after being dropped
+		if (madvise(memory, len, MADV_DONTNEED) == 0) {
+			return;
 		}
+		#else
+		if (mmap(memory, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED) {
+			return;
+		}
+		#endif
 	}
-	return MU_SUCCESS;
+	#else
+	(void)mapped;
+	#endif
+	mu_memset(memory, 0, len);
+}
+
+#ifdef MUB_GUARD_PAGE_MEMORY
+
+// guarded memory
+
+// values are at most 65535 bytes long, so no access that starts in a region can reach past its guard
+#define MUB_GUARD_LEN 65536
+
+// an execution whose faults in its context's memory jump back to it, linked to the one it happens within
+struct mubGuard {
+	sigjmp_buf jump;
+	muContext* context;
+	struct mubGuard* previous;
+};
+typedef struct mubGuard mubGuard;
+
+// innermost guarded execution on this thread
+__thread mubGuard* mub_guard_current = MU_NULL_PTR;
+// 0 before the fault handler is installed, 1 while it's being installed, 2 once it is, and 3 if it couldn't be
+long mub_guard_state = 0;
+size_m mub_guard_page_len = 4096;
+struct sigaction mub_guard_previous_segv;
+struct sigaction mub_guard_previous_bus;
+
+size_m mub_guard_round(size_m len) {
+	return (len + mub_guard_page_len - 1) & ~(mub_guard_page_len - 1);
 }
 
-muResult mu_context_fill_reg2_with_data_type(muContext* context, mubDataType dt, muByte* bytecode) {
-	if ((context->reg2 == MU_NULL_PTR) || (context->reg2_len < dt.byte_size)) {
-		if (context->reg2 != MU_NULL_PTR) {
-			mu_free(context->reg2);
+void mub_guard_handle_fault(int signal_number, siginfo_t* info, void* ucontext) {
+	muByte* address = (muByte*)info->si_addr;
+	for (mubGuard* guard = mub_guard_current; guard != MU_NULL_PTR; guard = guard->previous) {
+		muContext* context = guard->context;
+		if (context->memory_reserved > 0 && address >= context->memory && address < context->memory + context->memory_reserved) {
+			mub_guard_current = guard;
+			siglongjmp(guard->jump, 1);
 		}
-		context->reg2 = mu_malloc(dt.byte_size);
-		context->reg2_len = dt.byte_size;
 	}
-	if (dt.pointer_count == 0) {
-		mu_memcpy(context->reg2, bytecode, dt.byte_size);
+
+	// not ours, so it goes to whatever handled it before
+	struct sigaction* previous = (signal_number == SIGSEGV) ? &mub_guard_previous_segv : &mub_guard_previous_bus;
+	if ((previous->sa_flags & SA_SIGINFO) != 0) {
+		previous->sa_sigaction(signal_number, info, ucontext);
+	} else if (previous->sa_handler != SIG_DFL && previous->sa_handler != SIG_IGN) {
+		previous->sa_handler(signal_number);
 	} else {
-		if (context->reg2_len < context->bytewidth) {
-			context->reg2 = mu_realloc(context->reg2, context->bytewidth);
-			context->reg2_len = context->bytewidth;
-		}
-		mu_memcpy(context->reg2, bytecode, context->bytewidth);
-		while (dt.pointer_count > 0) {
-			if (dt.pointer_count != 1) {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg2, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg2, mem_loc, context->bytewidth);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			} else {
-				muByte* mem_loc = mu_context_get_memory_location(context, mu_context_get_reg_pointer_value(context->reg2, context->bytewidth), dt.temp);
-				if (mem_loc != MU_NULL_PTR) {
-					mu_memcpy(context->reg2, mem_loc, dt.byte_size);
-				} else {
-					mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-					return MU_FAILURE;
-				}
-			}
-			if (
-				dt.pointer_count != 1 && 
-				(mu_context_get_reg_pointer_value(context->reg2, context->bytewidth) + context->bytewidth) > context->static_memory_len + context->dynamic_memory_len
-			) {
-				mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-				return MU_FAILURE;
-			}
-			dt.pointer_count--;
+		// the fault happens again once this returns, this time with the default action
+		struct sigaction action;
+		mu_memset(&action, 0, sizeof(action));
+		action.sa_handler = SIG_DFL;
+		sigemptyset(&action.sa_mask);
+		sigaction(signal_number, &action, MU_NULL_PTR);
+	}
+}
+
+// installs the fault handler once per process
+muBool mub_guard_install(void) {
+	if (MUB_ATOMIC_CAS(&mub_guard_state, 0, 1)) {
+		long page_len = sysconf(_SC_PAGESIZE);
+		if (page_len > 0) {
+			mub_guard_page_len = (size_m)page_len;
+		}
+
+		struct sigaction action;
+		mu_memset(&action, 0, sizeof(action));
+		action.sa_sigaction = mub_guard_handle_fault;
+		// jumping out of the handler would leave the signal blocked if the handler blocked it
+		action.sa_flags = SA_SIGINFO | SA_NODEFER;
+		sigemptyset(&action.sa_mask);
+		if (sigaction(SIGSEGV, &action, &mub_guard_previous_segv) != 0 || sigaction(SIGBUS, &action, &mub_guard_previous_bus) != 0) {
+			MUB_ATOMIC_STORE(&mub_guard_state, 3);
+		} else {
+			MUB_ATOMIC_STORE(&mub_guard_state, 2);
 		}
 	}
-	return MU_SUCCESS;
+	long state = MUB_ATOMIC_LOAD(&mub_guard_state);
+	while (state == 1) {
+		state = MUB_ATOMIC_LOAD(&mub_guard_state);
+	}
+	return (state == 2) ? MU_TRUE : MU_FALSE;
 }
 
-// instructions
+// reserves one region for temporary memory and one for static and dynamic memory, each covering every address the
+// program's bytewidth can express plus a guard, with only the pages in use accessible
+muBool mub_reserve_guarded_memory(muContext* context) {
+	// wider addresses can't all be covered, and other allocators may expect memory to come from them
+	if (context->program->bytewidth > 4 || mub_is_default_allocator(&context->allocator) == MU_FALSE) {
+		return MU_FALSE;
+	}
+	uint64_m address_len = ((uint64_m)1) << (8 * context->program->bytewidth);
+	if (address_len > (uint64_m)(((size_m)-1) / 4) || context->temp_memory_len > address_len || context->static_memory_len > address_len) {
+		return MU_FALSE;
+	}
+	if (mub_guard_install() == MU_FALSE) {
+		return MU_FALSE;
+	}
 
-muResult mu_instruction_return_main(muContext* context, muByte* bytecode) {
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
-		return MU_FAILURE;
+	size_m region_len = mub_guard_round((size_m)address_len) + mub_guard_round(MUB_GUARD_LEN);
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	#ifdef MAP_NORESERVE
+	flags |= MAP_NORESERVE;
+	#endif
+	void* reservation = mmap(MU_NULL_PTR, region_len * 2, PROT_NONE, flags, -1, 0);
+	if (reservation == MAP_FAILED) {
+		return MU_FALSE;
 	}
-	
-	int32_m reg0_val = mu_context_get_reg_pointer_signed_value(context->reg0, src_dt.byte_size);
-	context->main_return = reg0_val;
-	
-	return MU_SUCCESS;
+	muByte* memory = (muByte*)reservation;
+	if (
+		(context->temp_memory_len > 0 && mprotect(memory, mub_guard_round(context->temp_memory_len), PROT_READ | PROT_WRITE) != 0) ||
+		(context->static_memory_len > 0 && mprotect(memory + region_len, mub_guard_round(context->static_memory_len), PROT_READ | PROT_WRITE) != 0)
+	) {
+		munmap(reservation, region_len * 2);
+		return MU_FALSE;
+	}
+
+	context->memory = memory;
+	context->memory_mapped = MU_FALSE;
+	context->memory_reserved = region_len * 2;
+	context->static_memory_offset = region_len;
+	return MU_TRUE;
 }
 
-muResult mu_instruction_print(muContext* context, muByte* bytecode) {
-	size_m offset = 0;
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
+// makes the pages behind dynamic memory accessible or not within its region, failing if it doesn't fit
+muResult mub_resize_guarded_memory(muContext* context, size_m new_capacity, muBool* zeroed) {
+	size_m limit = context->static_memory_offset - mub_guard_round(MUB_GUARD_LEN);
+	if (new_capacity > limit - context->static_memory_len) {
 		return MU_FAILURE;
 	}
 
-	offset = 0;
-	offset += 3;
-	if (src_dt.pointer_count > 0) {
-		offset += context->bytewidth;
-	} else {
-		offset += src_dt.byte_size;
+	muByte* static_memory = context->memory + context->static_memory_offset;
+	size_m len = context->static_memory_len + context->dynamic_memory_len;
+	size_m end = mub_guard_round(context->static_memory_len + context->dynamic_memory_capacity);
+	size_m new_end = mub_guard_round(context->static_memory_len + new_capacity);
+	if (new_end > end) {
+		if (mprotect(static_memory + end, new_end - end, PROT_READ | PROT_WRITE) != 0) {
+			return MU_FAILURE;
+		}
+		// pages that were already accessible may have been written past the length, the new ones are zero
+		mu_memset(static_memory + len, 0, end - len);
+		*zeroed = MU_TRUE;
+	} else if (new_end < end) {
+		// mapping the pages again gives back what they held
+		int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+		#ifdef MAP_NORESERVE
+		flags |= MAP_NORESERVE;
+		#endif
+		if (mmap(static_memory + new_end, end - new_end, PROT_NONE, flags, -1, 0) == MAP_FAILED) {
+			return MU_SUCCESS;
+		}
 	}
-	muByte spec_byte = bytecode[offset];
-	muByte type = (mu_bitcheck(spec_byte, 7) * 2) + mu_bitcheck(spec_byte, 6);
+	context->dynamic_memory_capacity = new_capacity;
+	return MU_SUCCESS;
+}
 
-	switch (type) { default: break;
-		// print integer / decimal
-		case 0: { case 1: {
-			switch (src_dt.byte_size) { default: break;
-				case 1: {
-					switch (src_dt.type) { default: break;
-						case MUB_DATA_TYPE_INTEGER: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu8_m"", *(uint8_m*)context->reg0); return MU_SUCCESS; } break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId8_m"", *(int8_m*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (src_dt.type) { default: break;
-						case MUB_DATA_TYPE_INTEGER: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu16_m"", *(uint16_m*)context->reg0); return MU_SUCCESS; } break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId16_m"", *(int16_m*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (src_dt.type) { default: break;
-						case MUB_DATA_TYPE_INTEGER: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu32_m"", *(uint32_m*)context->reg0); return MU_SUCCESS; } break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId32_m"", *(int32_m*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-						case MUB_DATA_TYPE_DECIMAL: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%f", *(float*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (src_dt.type) { default: break;
-						case MUB_DATA_TYPE_INTEGER: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu64_m"", *(uint64_m*)context->reg0); return MU_SUCCESS; } break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId64_m"", *(int64_m*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-						case MUB_DATA_TYPE_DECIMAL: {
-							switch (src_dt.sign) { default: break;
-								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%f", *(double*) context->reg0); return MU_SUCCESS; } break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break; } break;
-		// print character
-		case 2: {
-			if (src_dt.byte_size == 1) {
-				if (context->reg0[0] != '%') {
-					char arr[2] = { context->reg0[0], '\0' };
-					mu_printf("%s", arr);
-				} else {
-					char arr[3] = { context->reg0[0], context->reg0[0], '\0' };
-					mu_printf("%s", arr);
-				}
-			} else {
-				uint64_m reg0_val = mu_context_get_reg_pointer_value(context->reg0, src_dt.byte_size);
-				wchar_m arr[2] = { reg0_val, '\0' };
-				setlocale_m(MU_LC_ALL, "");
-				mu_printf("%ls", arr);
-			}
-			return MU_SUCCESS;
-		} break;
-	}
+#endif
 
-	mu_print("[MUB] Failed to execute print command; unrecognized type.\n");
+// ID tables
 
-	return MU_FAILURE;
+size_m mub_id_table_hash(mubIdTable* table, uint64_m id) {
+	id *= 0x9E3779B97F4A7C15ULL;
+	id ^= id >> 32;
+	return (size_m)id & (table->slot_len - 1);
 }
 
-muResult mu_instruction_set_dynamic_buffer_size(muContext* context, muByte* bytecode) {
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
-		return MU_FAILURE;
+// IDs are usually numbered from 0 or 1 in order, so an array is used unless that would waste too much memory
+muResult mub_id_table_create(mubIdTable* table, uint64_m max_id, size_m id_len, const muAllocator* allocator) {
+	table->slots = MU_NULL_PTR;
+	table->ids = MU_NULL_PTR;
+	table->slot_len = 0;
+	if (id_len == 0) {
+		return MU_SUCCESS;
 	}
 
-	if (src_dt.type != MUB_DATA_TYPE_INTEGER) {
-		mu_print("[MUB] Failed to set dynamic buffer size; type passed in for new size was non-integer.\n");
-		return MU_FAILURE;
+	if (max_id < (uint64_m)id_len * 4 + 16) {
+		table->slot_len = (size_m)max_id + 1;
+	} else {
+		table->slot_len = 1;
+		while (table->slot_len < id_len * 2) {
+			table->slot_len *= 2;
+		}
+		table->ids = mub_allocate(allocator, sizeof(uint64_m) * table->slot_len);
+		if (table->ids == MU_NULL_PTR) {
+			return MU_FAILURE;
+		}
 	}
-	if (src_dt.sign == MUB_DATA_TYPE_SIGNED) {
-		mu_print("[MUB] Failed to set dynamic buffer size; sign of data type for new size is signed.\n");
+	table->slots = mub_allocate(allocator, sizeof(size_m) * table->slot_len);
+	if (table->slots == MU_NULL_PTR) {
 		return MU_FAILURE;
 	}
+	mu_memset(table->slots, 0, sizeof(size_m) * table->slot_len);
+	return MU_SUCCESS;
+}
 
-	uint64_m reg0_val = mu_context_get_reg_pointer_value(context->reg0, src_dt.byte_size);
+void mub_id_table_destroy(mubIdTable* table, const muAllocator* allocator) {
+	if (table->slots != MU_NULL_PTR) {
+		mub_deallocate(allocator, table->slots);
+		table->slots = MU_NULL_PTR;
+	}
+	if (table->ids != MU_NULL_PTR) {
+		mub_deallocate(allocator, table->ids);
+		table->ids = MU_NULL_PTR;
+	}
+	table->slot_len = 0;
+}
 
-	if (reg0_val == 0) {
-		if (context->dynamic_memory != MU_NULL_PTR) {
-			mu_free(context->dynamic_memory);
-			context->dynamic_memory = MU_NULL_PTR;
-			context->dynamic_memory_len = 0;
+muBool mub_id_table_find(mubIdTable* table, uint64_m id, size_m* index) {
+	if (table->slot_len == 0) {
+		return MU_FALSE;
+	}
+	if (table->ids == MU_NULL_PTR) {
+		if (id >= table->slot_len || table->slots[id] == 0) {
+			return MU_FALSE;
 		}
-	} else {
-		if (context->dynamic_memory == MU_NULL_PTR) {
-			context->dynamic_memory = mu_malloc(reg0_val);
-			if (context->dynamic_memory == MU_NULL_PTR) {
-				mu_print("[MUB] Failed to set dynamic buffer size; malloc call failed.\n");
-				context->dynamic_memory_len = 0;
-				return MU_FAILURE;
-			}
-			mu_memset(context->dynamic_memory, 0, reg0_val);
-			context->dynamic_memory_len = reg0_val;
-		} else {
-			context->dynamic_memory = mu_realloc(context->dynamic_memory, reg0_val);
-			if (reg0_val > context->dynamic_memory_len) {
-				mu_memset(context->dynamic_memory + context->dynamic_memory_len, 0, reg0_val - context->dynamic_memory_len);
-			}
-			context->dynamic_memory_len = reg0_val;
+		*index = table->slots[id] - 1;
+		return MU_TRUE;
+	}
+	size_m slot = mub_id_table_hash(table, id);
+	while (table->slots[slot] != 0) {
+		if (table->ids[slot] == id) {
+			*index = table->slots[slot] - 1;
+			return MU_TRUE;
 		}
+		slot = (slot + 1) & (table->slot_len - 1);
 	}
-
-	return MU_SUCCESS;
+	return MU_FALSE;
 }
 
-muResult mu_two_operand_instruction(muContext* context, muByte* bytecode, int operator) {
-	size_m offset = 0;
-
-	// obtain value from src_dt into reg0 (pointer=0 means we have actual value)
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
-		return MU_FAILURE;
+// the first index given for an ID is kept, same as a search from the start of the bytecode would find
+void mub_id_table_insert(mubIdTable* table, uint64_m id, size_m index) {
+	size_m existing_index = 0;
+	if (mub_id_table_find(table, id, &existing_index) == MU_TRUE) {
+		return;
 	}
-
-	// obtain value from dst_dt into reg1 (pointer=0 means we have pointer to set value at)
-	offset = 0;
-	offset += 3;
-	if (src_dt.pointer_count > 0) {
-		offset += context->bytewidth;
-	} else {
-		offset += src_dt.byte_size;
+	if (table->ids == MU_NULL_PTR) {
+		table->slots[id] = index + 1;
+		return;
 	}
-	mubDataType dst_dt = mu_get_data_type_from_bytecode(&bytecode[offset]);
-	size_m orig_byte_size = dst_dt.byte_size;
-	dst_dt.byte_size = context->bytewidth;
-	if (mu_context_fill_reg1_with_data_type(context, dst_dt, &bytecode[offset+3]) != MU_SUCCESS) {
-		return MU_FAILURE;
+	size_m slot = mub_id_table_hash(table, id);
+	while (table->slots[slot] != 0) {
+		slot = (slot + 1) & (table->slot_len - 1);
 	}
-	dst_dt.byte_size = orig_byte_size;
+	table->ids[slot] = id;
+	table->slots[slot] = index + 1;
+}
 
-	// set memory address point stored in reg1 to reg0
+// name tables
 
-	uint64_m reg1_val = mu_context_get_reg_pointer_value(context->reg1, context->bytewidth);
-	if ((reg1_val + dst_dt.byte_size > context->static_memory_len + context->dynamic_memory_len) || reg1_val == 0) {
-		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-		return MU_FAILURE;
-	}
-	
-	if (
-		(src_dt.type == MUB_DATA_TYPE_VOID || src_dt.type == MUB_DATA_TYPE_STRUCT) ||
-		(dst_dt.type == MUB_DATA_TYPE_VOID || dst_dt.type == MUB_DATA_TYPE_STRUCT)
-	) {
-		for (size_m i = 0; i < src_dt.byte_size && i < dst_dt.byte_size; i++) {
-			muByte* mem_loc = mu_context_get_memory_location(context, reg1_val+i, dst_dt.temp);
-			if (mem_loc != MU_NULL_PTR) {
-				*mem_loc = context->reg0[i];
-			} else {
-				mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-				return MU_FAILURE;
-			}
-		}
-		return MU_SUCCESS;
+// FNV-1a
+uint64_m mub_name_hash(const char* name) {
+	uint64_m hash = 0xCBF29CE484222325ULL;
+	while (*name != '\0') {
+		hash ^= (muByte)*name;
+		hash *= 0x100000001B3ULL;
+		name++;
 	}
-	
-	return mub_perform_operation(context, src_dt, src_dt, dst_dt, operator, reg1_val, reg1_val);
+	return hash;
 }
 
-muResult mu_three_operand_instruction(muContext* context, muByte* bytecode, int operator) {
-	size_m offset = 3;
-
-	// obtain value from src0_dt into reg0 (pointer=0 means we have actual value)
-	mubDataType src0_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src0_dt, &bytecode[offset]) != MU_SUCCESS) {
-		return MU_FAILURE;
+muResult mub_name_table_create(mubNameTable* table, size_m name_len, const muAllocator* allocator) {
+	table->slots = MU_NULL_PTR;
+	table->hashes = MU_NULL_PTR;
+	table->names = MU_NULL_PTR;
+	table->slot_len = 0;
+	if (name_len == 0) {
+		return MU_SUCCESS;
 	}
 
-	// obtain value from src1_dt into reg1 (pointer=0 means we have pointer to set value at)
-	if (src0_dt.pointer_count > 0) {
-		offset += context->bytewidth;
-	} else {
-		offset += src0_dt.byte_size;
+	table->slot_len = 1;
+	while (table->slot_len < name_len * 2) {
+		table->slot_len *= 2;
 	}
-	mubDataType src1_dt = src0_dt;
-	if (mu_context_fill_reg1_with_data_type(context, src1_dt, &bytecode[offset]) != MU_SUCCESS) {
+	table->slots = mub_allocate(allocator, sizeof(size_m) * table->slot_len);
+	table->hashes = mub_allocate(allocator, sizeof(uint64_m) * table->slot_len);
+	table->names = mub_allocate(allocator, sizeof(const char*) * table->slot_len);
+	if (table->slots == MU_NULL_PTR || table->hashes == MU_NULL_PTR || table->names == MU_NULL_PTR) {
 		return MU_FAILURE;
 	}
+	mu_memset(table->slots, 0, sizeof(size_m) * table->slot_len);
+	return MU_SUCCESS;
+}
 
-	// obtain value from dst_dt into reg2
-	if (src1_dt.pointer_count > 0) {
-		offset += context->bytewidth;
-	} else {
-		offset += src1_dt.byte_size;
-	}
-	mubDataType dst_dt = mu_get_data_type_from_bytecode(&bytecode[offset]);
-	offset += 3;
-	size_m orig_byte_size = dst_dt.byte_size;
-	dst_dt.byte_size = context->bytewidth;
-	if (mu_context_fill_reg2_with_data_type(context, dst_dt, &bytecode[offset]) != MU_SUCCESS) {
-		return MU_FAILURE;
+void mub_name_table_destroy(mubNameTable* table, const muAllocator* allocator) {
+	if (table->slots != MU_NULL_PTR) {
+		mub_deallocate(allocator, table->slots);
+		table->slots = MU_NULL_PTR;
 	}
-	dst_dt.byte_size = orig_byte_size;
-
-	// set memory address point stored in reg2 to reg0 + reg1
-	
-	uint64_m reg2_val = mu_context_get_reg_pointer_value(context->reg2, context->bytewidth);
-	if ((reg2_val + dst_dt.byte_size > context->static_memory_len + context->dynamic_memory_len) || reg2_val == 0) {
-		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
-		return MU_FAILURE;
+	if (table->hashes != MU_NULL_PTR) {
+		mub_deallocate(allocator, table->hashes);
+		table->hashes = MU_NULL_PTR;
 	}
-	
-	if (
-		(src0_dt.type == MUB_DATA_TYPE_VOID || src0_dt.type == MUB_DATA_TYPE_STRUCT) ||
-		(src1_dt.type == MUB_DATA_TYPE_VOID || src1_dt.type == MUB_DATA_TYPE_STRUCT) ||
-		(dst_dt.type == MUB_DATA_TYPE_VOID || dst_dt.type == MUB_DATA_TYPE_STRUCT)
-	) {
-		mu_print("[MUB] Invalid mathematical operation.\n");
-		return MU_FAILURE;
+	if (table->names != MU_NULL_PTR) {
+		mub_deallocate(allocator, (void*)table->names);
+		table->names = MU_NULL_PTR;
 	}
-	
-	return mub_perform_operation(context, src0_dt, src1_dt, dst_dt, operator, reg2_val, reg2_val);
-}
-
-muResult mu_instruction_move(muContext* context, muByte* bytecode) {
-	return mu_two_operand_instruction(context, bytecode, MUB_OPERATION_MOVE);
-}
-
-muResult mu_instruction_add(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_ADD);
-}
-
-muResult mu_instruction_subtract(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_SUBTRACT);
-}
-
-muResult mu_instruction_multiply(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_MULTIPLY);
-}
-
-muResult mu_instruction_divide(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_DIVIDE);
-}
-
-muResult mu_instruction_modulo(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_MODULO);
-}
-
-muResult mu_instruction_bw_not(muContext* context, muByte* bytecode) {
-	return mu_two_operand_instruction(context, bytecode, MUB_OPERATION_BW_NOT);
+	table->slot_len = 0;
 }
 
-muResult mu_instruction_bw_and(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_BW_AND);
+// gives the slot holding the name, or the empty slot it would be inserted at
+size_m mub_name_table_probe(mubNameTable* table, const char* name, uint64_m hash) {
+	size_m slot = (size_m)(hash ^ (hash >> 32)) & (table->slot_len - 1);
+	while (table->slots[slot] != 0) {
+		if (table->hashes[slot] == hash && mu_strcmp(table->names[slot], name) == 0) {
+			return slot;
+		}
+		slot = (slot + 1) & (table->slot_len - 1);
+	}
+	return slot;
 }
 
-muResult mu_instruction_bw_or(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_BW_OR);
+muBool mub_name_table_find(mubNameTable* table, const char* name, size_m* index) {
+	if (table->slot_len == 0 || name == MU_NULL_PTR) {
+		return MU_FALSE;
+	}
+	size_m slot = mub_name_table_probe(table, name, mub_name_hash(name));
+	if (table->slots[slot] == 0) {
+		return MU_FALSE;
+	}
+	*index = table->slots[slot] - 1;
+	return MU_TRUE;
 }
 
-muResult mu_instruction_bw_xor(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_BW_XOR);
+// like ID tables, the first index given for a name is kept
+void mub_name_table_insert(mubNameTable* table, const char* name, size_m index) {
+	if (name == MU_NULL_PTR) {
+		return;
+	}
+	uint64_m hash = mub_name_hash(name);
+	size_m slot = mub_name_table_probe(table, name, hash);
+	if (table->slots[slot] != 0) {
+		return;
+	}
+	table->slots[slot] = index + 1;
+	table->hashes[slot] = hash;
+	table->names[slot] = name;
 }
 
-muResult mu_instruction_bw_lshift(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_BW_LSHIFT);
-}
+// registers
 
-muResult mu_instruction_bw_rshift(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_BW_RSHIFT);
+uint64_m mu_context_get_reg_pointer_value(muByte* reg, size_m reg_len) {
+	switch (reg_len) {
+	default:
+		return 0;
+		break;
+	case 1:
+		return mu_get_uint8_from_bytecode(reg);
+		break;
+	case 2:
+		return mu_get_uint16_from_bytecode(reg);
+		break;
+	case 4:
+		return mu_get_uint32_from_bytecode(reg);
+		break;
+	case 8:
+		return mu_get_uint64_from_bytecode(reg);
+		break;
+	}
 }
 
-muResult mu_instruction_cond_equal(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_EQUAL);
+int64_m mu_context_get_reg_pointer_signed_value(muByte* reg, size_m reg_len) {
+	switch (reg_len) {
+	default:
+		return 0;
+		break;
+	case 1:
+		return mu_get_int8_from_bytecode(reg);
+		break;
+	case 2:
+		return mu_get_int16_from_bytecode(reg);
+		break;
+	case 4:
+		return mu_get_int32_from_bytecode(reg);
+		break;
+	case 8:
+		return mu_get_int64_from_bytecode(reg);
+		break;
+	}
 }
 
-muResult mu_instruction_cond_not_equal(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_NOT_EQUAL);
+// points temporary, static, and dynamic memory at their places in a flat context's single allocation, leaving empty
+// ones null as they are otherwise
+void mub_set_memory_sections(muContext* context) {
+	context->temp_memory = MU_NULL_PTR;
+	context->static_memory = MU_NULL_PTR;
+	context->dynamic_memory = MU_NULL_PTR;
+	if (context->memory == MU_NULL_PTR) {
+		return;
+	}
+	if (context->temp_memory_len > 0) {
+		context->temp_memory = context->memory;
+	}
+	if (context->static_memory_len > 0) {
+		context->static_memory = context->memory + context->static_memory_offset;
+	}
+	if (context->dynamic_memory_len > 0) {
+		context->dynamic_memory = context->memory + context->static_memory_offset + context->static_memory_len;
+	}
 }
 
-muResult mu_instruction_cond_less(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_LESS);
+// frees a flat context's single allocation
+void mub_free_flat_memory(muContext* context) {
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	if (context->memory_reserved > 0) {
+		munmap(context->memory, context->memory_reserved);
+		context->memory = MU_NULL_PTR;
+		context->memory_reserved = 0;
+		return;
+	}
+	#endif
+	mub_free_zeroed_memory(&context->allocator, context->memory, context->temp_memory_len + context->static_memory_len + context->dynamic_memory_capacity, context->memory_mapped);
+	context->memory = MU_NULL_PTR;
+	context->memory_mapped = MU_FALSE;
 }
 
-muResult mu_instruction_cond_less_equal(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_LESS_EQUAL);
+muByte* mu_context_get_memory_location(muContext* context, size_m index, int buffer) {
+	#ifdef MUB_FLAT_MEMORY
+	// dynamic memory directly follows static memory, so an address in either is one comparison away
+	if (buffer == 0) {
+		if (index < context->static_memory_len + context->dynamic_memory_len) {
+			return &context->memory[context->static_memory_offset + index];
+		}
+		return MU_NULL_PTR;
+	}
+	#else
+	if (buffer == 0) {
+		if (index < context->static_memory_len) {
+			return &context->static_memory[index];
+		} else {
+			index -= context->static_memory_len;
+			if (index < context->dynamic_memory_len) {
+				return &context->dynamic_memory[index];
+			}
+			return MU_NULL_PTR;
+		}
+	}
+	#endif
+	if (index < context->temp_memory_len) {
+		return &context->temp_memory[index];
+	}
+	return MU_NULL_PTR;
 }
 
-muResult mu_instruction_cond_greater(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_GREATER);
+// number of addressable bytes in a buffer; static and dynamic memory for 0, temporary memory otherwise
+size_m mub_get_memory_len(muContext* context, int buffer) {
+	if (buffer == 0) {
+		return context->static_memory_len + context->dynamic_memory_len;
+	}
+	return context->temp_memory_len;
 }
 
-muResult mu_instruction_cond_greater_equal(muContext* context, muByte* bytecode) {
-	return mu_three_operand_instruction(context, bytecode, MUB_OPERATION_COND_GREATER_EQUAL);
+// where len bytes starting at an address are, or MU_NULL_PTR if they don't all lie contiguously in the buffer
+muByte* mub_get_memory_range(muContext* context, uint64_m index, size_m len, int buffer) {
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	// no address or value is long enough to get past the guard after its region, so accesses outside of memory fault
+	if (context->memory_reserved > 0) {
+		return &context->memory[((buffer == 0) ? context->static_memory_offset : 0) + index];
+	}
+	#endif
+	#ifdef MUB_FLAT_MEMORY
+	size_m memory_len = mub_get_memory_len(context, buffer);
+	if (len > memory_len || index > memory_len - len) {
+		return MU_NULL_PTR;
+	}
+	return &context->memory[((buffer == 0) ? context->static_memory_offset : 0) + index];
+	#else
+	muByte* start = mu_context_get_memory_location(context, index, buffer);
+	if (start == MU_NULL_PTR || len == 0) {
+		return start;
+	}
+	// static and dynamic memory are separate allocations, so the last byte has to be in the same one as the first
+	muByte* end = mu_context_get_memory_location(context, index + len - 1, buffer);
+	if (end == MU_NULL_PTR || end < start || (size_m)(end - start) != len - 1) {
+		return MU_NULL_PTR;
+	}
+	return start;
+	#endif
 }
 
-muResult mu_instruction_if(muContext* context, muByte* bytecode) {
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
+// copies len bytes into (store) or out of memory at an address, checking the whole range once; the bytes may straddle
+// static and dynamic memory, which are separate allocations unless memory is flat
+muResult mub_copy_memory(muContext* context, uint64_m index, muByte* bytes, size_m len, int buffer, muBool store) {
+	size_m memory_len = mub_get_memory_len(context, buffer);
+	if (len > memory_len || index > memory_len - len) {
 		return MU_FAILURE;
 	}
+	if (len == 0) {
+		return MU_SUCCESS;
+	}
 
-	context->last_if = MU_FALSE;
-	if (src_dt.pointer_count == 0) {
-		for (size_m i = 0; i < src_dt.byte_size; i++) {
-			if (context->reg0[i] != 0) {
-				context->last_if = MU_TRUE;
-			}
+	muByte* mem_loc = mub_get_memory_range(context, index, len, buffer);
+	size_m first_len = len;
+	if (mem_loc == MU_NULL_PTR) {
+		mem_loc = &context->static_memory[index];
+		first_len = context->static_memory_len - index;
+	}
+	if (store == MU_TRUE) {
+		mu_memcpy(mem_loc, bytes, first_len);
+		if (first_len < len) {
+			mu_memcpy(context->dynamic_memory, bytes + first_len, len - first_len);
 		}
 	} else {
-		for (size_m i = 0; i < context->bytewidth; i++) {
-			if (context->reg0[i] != 0) {
-				context->last_if = MU_TRUE;
-			}
+		mu_memcpy(bytes, mem_loc, first_len);
+		if (first_len < len) {
+			mu_memcpy(bytes + first_len, context->dynamic_memory, len - first_len);
 		}
 	}
-
 	return MU_SUCCESS;
 }
 
-muResult mub_execute_function(muContext* context, muByte* bytecode);
-
-muResult mu_instruction_call_function(muContext* context, muByte* bytecode) {
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
+muResult mub_read_address(muContext* context, uint64_m* address, muByte temp) {
+	muByte* mem_loc = mub_get_memory_range(context, *address, context->program->bytewidth, temp);
+	if (mem_loc == MU_NULL_PTR) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
 		return MU_FAILURE;
 	}
+	*address = mu_context_get_reg_pointer_value(mem_loc, context->program->bytewidth);
+	return MU_SUCCESS;
+}
 
-	uint64_m reg0_val = mu_context_get_reg_pointer_value(context->reg0, src_dt.byte_size);
-	if (reg0_val < context->function_len && context->functions[reg0_val-1].index == reg0_val) {
-		return mub_execute_function(context, &context->bytecode[context->functions[reg0_val-1].bytecode_index]);
-	}
-	for (size_m i = 0; i < context->function_len; i++) {
-		if (context->functions[i].index == reg0_val) {
-			return mub_execute_function(context, &context->bytecode[context->functions[i].bytecode_index]);
+// follows all but the last dereference of an operand, leaving the address of its final value
+muResult mub_dereference_operand(muContext* context, mubOperand* operand, uint64_m* address) {
+	*address = operand->address;
+	for (muByte i = 1; i < operand->datatype.pointer_count; i++) {
+		if (mub_read_address(context, address, operand->datatype.temp) != MU_SUCCESS) {
+			return MU_FAILURE;
 		}
 	}
-	mu_print("[MUB] WARNING! Unrecognized function ID when executing bytecode. Bytecode may not execute properly.\n");
-	return MU_FAILURE;
+	return MU_SUCCESS;
 }
 
-muResult mu_instruction_call_external_function(muContext* context, muByte* bytecode) {
-	mubDataType src_dt = mu_get_data_type_from_bytecode(bytecode);
-	if (mu_context_fill_reg0_with_data_type(context, src_dt, &bytecode[3]) != MU_SUCCESS) {
-		return MU_FAILURE;
+// where a register holds a value of the given size
+muByte* mub_get_register(mubRegister* reg, size_m len) {
+	if (len <= sizeof(reg->value)) {
+		return reg->value.bytes;
 	}
+	return reg->spill;
+}
 
-	uint64_m reg0_val = mu_context_get_reg_pointer_value(context->reg0, src_dt.byte_size);
-	size_m index = 0;
-	muBool found_index = MU_FALSE;
-	if (reg0_val < context->external_function_len && context->external_functions[reg0_val].index == reg0_val) {
-		index = reg0_val;
-		found_index = MU_TRUE;
-	} else {
-		for (size_m i = 0; i < context->external_function_len; i++) {
-			if (context->external_functions[i].index == reg0_val) {
-				index = i;
-				found_index = MU_TRUE;
-				break;
-			}
-		}
+muResult mub_fill_reg_with_operand(muContext* context, mubRegister* register_, mubOperand* operand) {
+	mubDataType dt = operand->datatype;
+	if (dt.byte_size > sizeof(register_->value) && dt.byte_size > register_->spill_len) {
+		mu_print("[MUB] Failed to fill register; value is bigger than expected.\n");
+		return MU_FAILURE;
 	}
-	if (found_index == MU_FALSE) {
-		mu_print("[MUB] Failed to call external function; could not find external function with specified index.\n");
+	muByte* reg = mub_get_register(register_, dt.byte_size);
+	if (dt.pointer_count == 0) {
+		if (dt.byte_size <= sizeof(operand->immediate)) {
+			mu_memcpy(reg, operand->immediate, dt.byte_size);
+		} else {
+			mu_memcpy(reg, &context->program->bytecode[operand->bytecode_index], dt.byte_size);
+		}
+		return MU_SUCCESS;
+	}
+
+	uint64_m address = 0;
+	if (mub_dereference_operand(context, operand, &address) != MU_SUCCESS) {
 		return MU_FAILURE;
 	}
+	muByte* mem_loc = mub_get_memory_range(context, address, dt.byte_size, dt.temp);
+	if (mem_loc != MU_NULL_PTR) {
+		mu_memcpy(reg, mem_loc, dt.byte_size);
+		return MU_SUCCESS;
+	}
+	// large values can straddle static and dynamic memory
+	if (mub_copy_memory(context, address, reg, dt.byte_size, dt.temp, MU_FALSE) != MU_SUCCESS) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
+	}
+	return MU_SUCCESS;
+}
 
-	if (context->external_functions[index].function == MU_NULL_PTR) {
-		mu_print("[MUB] Failed to call external function; specified external function has no function associated with it.\n");
+muResult mu_context_fill_reg0_with_operand(muContext* context, mubOperand* operand) {
+	return mub_fill_reg_with_operand(context, &context->reg0, operand);
+}
+
+muResult mu_context_fill_reg1_with_operand(muContext* context, mubOperand* operand) {
+	return mub_fill_reg_with_operand(context, &context->reg1, operand);
+}
+
+// destination values are always addresses, so every dereference reads another address
+muResult mu_context_get_destination_address(muContext* context, mubOperand* operand, uint64_m* address) {
+	if (mub_dereference_operand(context, operand, address) != MU_SUCCESS) {
 		return MU_FAILURE;
 	}
-	context->external_functions[index].function(context);
+	if (operand->datatype.pointer_count > 0) {
+		return mub_read_address(context, address, operand->datatype.temp);
+	}
 	return MU_SUCCESS;
 }
 
-size_m mub_get_step_from_data_type(muContext* context, muByte* bytecode) {
-	size_m step = 3;
-	mubDataType dt0 = mu_get_data_type_from_bytecode(bytecode);
-	if (dt0.pointer_count > 0) {
-		step += context->bytewidth;
-	} else {
-		step += dt0.byte_size;
+// instructions
+
+muResult mu_instruction_return_main(muContext* context, mubInstruction* instruction) {
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
-	return step;
+	
+	int32_m reg0_val = mu_context_get_reg_pointer_signed_value(mub_get_register(&context->reg0, instruction->src0.datatype.byte_size), instruction->src0.datatype.byte_size);
+	context->main_return = reg0_val;
+	
+	return MU_SUCCESS;
 }
 
-muByte* mub_advance_header(muResult* res, muContext* context, muByte* bytecode, muByte* bytecode_beginning, size_m bytecode_len, muBool executing) {
-	if (res != MU_NULL_PTR) {
-		*res = MU_SUCCESS;
+muResult mu_instruction_print(muContext* context, mubInstruction* instruction) {
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
-	switch (bytecode[0]) {
-		case 0x00: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1); return bytecode; break;
-		case 0x01: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1) + 1; return bytecode; break;
-		case 0x02: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1); return bytecode; break;
-		// name setters
-		case 0x10: bytecode++; bytecode += context->function_id_byte_len; while (bytecode[0] != '\0' && bytecode < bytecode_beginning + bytecode_len) { bytecode++; } bytecode++; return bytecode; break;
-		case 0x11: bytecode++; bytecode += context->bytewidth; bytecode += 3; while (bytecode[0] != '\0' && bytecode < bytecode_beginning + bytecode_len) { bytecode++; } bytecode++; return bytecode; break;
-		case 0x12: bytecode++; bytecode += context->external_function_id_byte_len; while (bytecode[0] != '\0' && bytecode < bytecode_beginning + bytecode_len) { bytecode++; } bytecode++; return bytecode; break;
-		// beginning stuff
-		case 0x6D: if (bytecode == bytecode_beginning) { return bytecode + 16; } break;
-		// end stuff
-		case 0x65: if (bytecode + 4 == bytecode_beginning + bytecode_len) { return bytecode + 4; } break;
-		// commands
-		case 0x80: case 0x86: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1) + 3 + (context->bytewidth); return bytecode; break;
-		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
-		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: {
-			bytecode += 1 + 3 + ((mub_get_step_from_data_type(context, bytecode+1) - 3) * 2);
-			bytecode += 3 + context->bytewidth; 
-			return bytecode;
-		} break;
-		// functions
-		case 0xE0: bytecode++; bytecode += context->function_id_byte_len; return bytecode; break;
-		case 0xE1: bytecode++; return bytecode; break;
-		case 0xE2: bytecode++; return bytecode; break;
-		case 0xE3: case 0xE4: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1); return bytecode; break;
-		// jump markers
-		case 0xF0: bytecode++; bytecode += context->jump_marker_id_byte_len; return bytecode; break;
-		case 0xF1: {
-			bytecode++;
-			uint64_m val = 0;
-			switch (context->jump_marker_id_byte_len) { default: break;
-				case 1: val = mu_get_uint8_from_bytecode(bytecode); bytecode ++;   break;
-				case 2: val = mu_get_uint16_from_bytecode(bytecode); bytecode += 2; break;
-				case 4: val = mu_get_uint32_from_bytecode(bytecode); bytecode += 4; break;
-				case 8: val = mu_get_uint64_from_bytecode(bytecode); bytecode += 8; break;
-			}
-			if (!executing) {
-				return bytecode;
-			}
-			if (val < context->jump_marker_len && context->jump_markers[val].index == val) {
-				return &context->bytecode[context->jump_markers[val].bytecode_index];
+
+	muByte* reg0 = mub_get_register(&context->reg0, src_dt.byte_size);
+	muByte spec_byte = instruction->spec;
+	muByte type = (mu_bitcheck(spec_byte, 7) * 2) + mu_bitcheck(spec_byte, 6);
+
+	switch (type) { default: break;
+		// print integer / decimal
+		case 0: { case 1: {
+			switch (src_dt.byte_size) { default: break;
+				case 1: {
+					switch (src_dt.type) { default: break;
+						case MUB_DATA_TYPE_INTEGER: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu8_m"", *(uint8_m*)reg0); return MU_SUCCESS; } break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId8_m"", *(int8_m*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+					}
+				} break;
+				case 2: {
+					switch (src_dt.type) { default: break;
+						case MUB_DATA_TYPE_INTEGER: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu16_m"", *(uint16_m*)reg0); return MU_SUCCESS; } break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId16_m"", *(int16_m*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+					}
+				} break;
+				case 4: {
+					switch (src_dt.type) { default: break;
+						case MUB_DATA_TYPE_INTEGER: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu32_m"", *(uint32_m*)reg0); return MU_SUCCESS; } break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId32_m"", *(int32_m*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+						case MUB_DATA_TYPE_DECIMAL: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%f", *(float*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+					}
+				} break;
+				case 8: {
+					switch (src_dt.type) { default: break;
+						case MUB_DATA_TYPE_INTEGER: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_UNSIGNED: { mu_printf("%"PRIu64_m"", *(uint64_m*)reg0); return MU_SUCCESS; } break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%"PRId64_m"", *(int64_m*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+						case MUB_DATA_TYPE_DECIMAL: {
+							switch (src_dt.sign) { default: break;
+								case MUB_DATA_TYPE_SIGNED:   { mu_printf("%f", *(double*) reg0); return MU_SUCCESS; } break;
+							}
+						} break;
+					}
+				} break;
 			}
-			for (size_m i = 0; i < context->jump_marker_len; i++) {
-				if (context->jump_markers[i].index == val) {
-					return &context->bytecode[context->jump_markers[i].bytecode_index];
+		} break; } break;
+		// print character
+		case 2: {
+			if (src_dt.byte_size == 1) {
+				if (reg0[0] != '%') {
+					char arr[2] = { reg0[0], '\0' };
+					mu_printf("%s", arr);
+				} else {
+					char arr[3] = { reg0[0], reg0[0], '\0' };
+					mu_printf("%s", arr);
 				}
+			} else {
+				uint64_m reg0_val = mu_context_get_reg_pointer_value(reg0, src_dt.byte_size);
+				wchar_m arr[2] = { reg0_val, '\0' };
+				setlocale_m(MU_LC_ALL, "");
+				mu_printf("%ls", arr);
 			}
-			return bytecode;
-		}
-		// other stuff
-		case 0xA0: bytecode += 1 + mub_get_step_from_data_type(context, bytecode+1); return bytecode; break;
-		case 0xA1: bytecode++; return bytecode; break;
-		case 0xA2: bytecode++; return bytecode; break;
-	}
-	if (res != MU_NULL_PTR) {
-		*res = MU_FAILURE;
+			return MU_SUCCESS;
+		} break;
 	}
-	mu_print("[MUB] WARNING! Unrecognized command found when scanning bytecode. Bytecode may not execute properly.\n");
-	return bytecode + 1;
+
+	mu_print("[MUB] Failed to execute print command; unrecognized type.\n");
+
+	return MU_FAILURE;
 }
 
-muResult mub_execute_command(muContext* context, muByte* bytecode);
+// resizes the allocation behind dynamic memory, setting zeroed to whether everything past its length is now zero;
+// shrinking may keep the old allocation if it can't be resized
+muResult mub_resize_dynamic_memory(muContext* context, size_m new_capacity, muBool* zeroed) {
+	size_m capacity = context->dynamic_memory_capacity;
+	*zeroed = MU_FALSE;
 
-muResult mub_execute_function(muContext* context, muByte* bytecode) {
-	muByte* step = bytecode;
-	while (step < context->bytecode + context->bytecode_len) {
-		if (step[0] == 0xE1 || step[0] == 0xE2) {
+	#ifdef MUB_FLAT_MEMORY
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	if (context->memory_reserved > 0) {
+		if (mub_resize_guarded_memory(context, new_capacity, zeroed) == MU_SUCCESS) {
 			return MU_SUCCESS;
 		}
-		muBool ifCheck = MU_FALSE;
-		if (step[0] == 0xA0) {
-			ifCheck = MU_TRUE;
+		// it doesn't fit in the reservation, so memory moves to an unguarded allocation below
+	}
+	#endif
+
+	// temporary and static memory sit before dynamic memory in the same allocation, and move along with it
+	size_m base_len = context->temp_memory_len + context->static_memory_len;
+	if (new_capacity > ((size_m)-1) - base_len) {
+		mu_print("[MUB] Failed to set dynamic buffer size; size is too big.\n");
+		return MU_FAILURE;
+	}
+	size_m len = base_len + capacity;
+	size_m new_len = base_len + new_capacity;
+
+	muByte* memory = MU_NULL_PTR;
+	if (new_len == 0) {
+		mub_free_flat_memory(context);
+	} else if (context->memory == MU_NULL_PTR || context->memory_mapped == MU_TRUE || context->memory_reserved > 0) {
+		// mappings can't be resized portably, so what's in use is copied into a new allocation instead
+		if (new_capacity < capacity) {
+			return MU_SUCCESS;
 		}
-		if (mub_execute_command(context, step) != MU_SUCCESS) {
+		muBool mapped = MU_FALSE;
+		memory = mub_allocate_zeroed_memory(&context->allocator, new_len, &mapped);
+		if (memory == MU_NULL_PTR) {
+			mu_print("[MUB] Failed to set dynamic buffer size; malloc call failed.\n");
 			return MU_FAILURE;
 		}
-		if ((ifCheck && context->last_if == MU_FALSE) || step[0] == 0xA2) {
-			size_m if_count = 1;
-			while (if_count != 0 && step < context->bytecode + context->bytecode_len) {
-				step = mub_advance_header(MU_NULL_PTR, context, step, context->bytecode, context->bytecode_len, MU_FALSE);
-				if (step[0] == 0xA0 || step[0] == 0xA2) {
-					if_count++;
-				} else if (step[0] == 0xA1) {
-					if_count--;
-				}
-			}
-			if (step[1] == 0xA2) {
-				step += 2;
+		if (context->memory != MU_NULL_PTR) {
+			mu_memcpy(memory, context->memory, context->temp_memory_len);
+			mu_memcpy(memory + context->temp_memory_len, context->memory + context->static_memory_offset, context->static_memory_len + context->dynamic_memory_len);
+			mub_free_flat_memory(context);
+		}
+		context->memory_mapped = mapped;
+		context->static_memory_offset = context->temp_memory_len;
+		*zeroed = MU_TRUE;
+	} else {
+		memory = mub_reallocate(&context->allocator, context->memory, len, new_len);
+		if (memory == MU_NULL_PTR) {
+			if (new_capacity > capacity) {
+				mu_print("[MUB] Failed to set dynamic buffer size; realloc call failed.\n");
+				return MU_FAILURE;
 			}
-		} else {
-			step = mub_advance_header(MU_NULL_PTR, context, step, context->bytecode, context->bytecode_len, MU_TRUE);
+			return MU_SUCCESS;
 		}
 	}
-	mu_print("[MUB] Failed to execute function; no end to the function was found.\n");
-	return MU_FAILURE;
-}
-
-muResult mub_execute_command(muContext* context, muByte* bytecode) {
-	switch (bytecode[0]) { default: break;
-	case 0x00: return mu_instruction_return_main(context, bytecode+1); break;
-	case 0x01: return mu_instruction_print(context, bytecode+1); break;
-	case 0x02: return mu_instruction_set_dynamic_buffer_size(context, bytecode+1); break;
-	case 0x10: return MU_SUCCESS; break;
-	case 0x11: return MU_SUCCESS; break;
-	case 0x12: return MU_SUCCESS; break;
-	case 0x80: return mu_instruction_move(context, bytecode+1); break;
-	case 0x81: return mu_instruction_add(context, bytecode+1); break;
-	case 0x82: return mu_instruction_subtract(context, bytecode+1); break;
-	case 0x83: return mu_instruction_multiply(context, bytecode+1); break;
-	case 0x84: return mu_instruction_divide(context, bytecode+1); break;
-	case 0x85: return mu_instruction_modulo(context, bytecode+1); break;
-	case 0x86: return mu_instruction_bw_not(context, bytecode+1); break;
-	case 0x87: return mu_instruction_bw_and(context, bytecode+1); break;
-	case 0x88: return mu_instruction_bw_or(context, bytecode+1); break;
-	case 0x89: return mu_instruction_bw_xor(context, bytecode+1); break;
-	case 0x8A: return mu_instruction_bw_lshift(context, bytecode+1); break;
-	case 0x8B: return mu_instruction_bw_rshift(context, bytecode+1); break;
-	case 0x90: return mu_instruction_cond_equal(context, bytecode+1); break;
-	case 0x91: return mu_instruction_cond_not_equal(context, bytecode+1); break;
-	case 0x92: return mu_instruction_cond_less(context, bytecode+1); break;
-	case 0x93: return mu_instruction_cond_less_equal(context, bytecode+1); break;
-	case 0x94: return mu_instruction_cond_greater(context, bytecode+1); break;
-	case 0x95: return mu_instruction_cond_greater_equal(context, bytecode+1); break;
-	case 0xA0: return mu_instruction_if(context, bytecode+1); break;
-	case 0xA1: return MU_SUCCESS; break;
-	case 0xA2: return MU_SUCCESS; break;
-	case 0xF0: return MU_SUCCESS; break;
-	case 0xF1: return MU_SUCCESS; break;
-	case 0xE0: return MU_SUCCESS; break;
-	case 0xE1: return MU_SUCCESS; break;
-	case 0xE2: return MU_SUCCESS; break;
-	case 0xE3: return mu_instruction_call_function(context, bytecode+1); break;
-	case 0xE4: return mu_instruction_call_external_function(context, bytecode+1); break;
-	}
-	mu_print("[MUB] WARNING! Unrecognized command when executing. Bytecode may not execute properly.\n");
-	return MU_FAILURE;
-}
-
-/* functions */
+	context->memory = memory;
+	context->dynamic_memory_capacity = new_capacity;
+	return MU_SUCCESS;
 
-MUDEF muContext mu_context_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
-    muContext context = {0};
-    context.alive = MU_FALSE;
-	
-	if (mu_bytecode_check_header_validity(bytecode, bytecode_len) != MU_SUCCESS) {
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
+	#else
+	if (new_capacity == 0) {
+		mub_deallocate(&context->allocator, context->dynamic_memory);
+		context->dynamic_memory = MU_NULL_PTR;
+	} else if (context->dynamic_memory == MU_NULL_PTR) {
+		context->dynamic_memory = mub_allocate_zeroed(&context->allocator, new_capacity);
+		if (context->dynamic_memory == MU_NULL_PTR) {
+			mu_print("[MUB] Failed to set dynamic buffer size; malloc call failed.\n");
+			context->dynamic_memory_len = 0;
+			context->dynamic_memory_capacity = 0;
+			return MU_FAILURE;
 		}
-		return context;
+		*zeroed = MU_TRUE;
+	} else {
+		muByte* dynamic_memory = mub_reallocate(&context->allocator, context->dynamic_memory, capacity, new_capacity);
+		if (dynamic_memory == MU_NULL_PTR) {
+			// shrinking can just keep the bigger allocation
+			if (new_capacity > capacity) {
+				mu_print("[MUB] Failed to set dynamic buffer size; realloc call failed.\n");
+				return MU_FAILURE;
+			}
+			return MU_SUCCESS;
+		}
+		context->dynamic_memory = dynamic_memory;
 	}
+	context->dynamic_memory_capacity = new_capacity;
+	return MU_SUCCESS;
+	#endif
+}
 
-	unsigned char quick_bit_len = 
-	(mu_bitcheck(bytecode[4], 6) * 1) + 
-	(mu_bitcheck(bytecode[4], 7) * 2);
-	context.bytewidth = 1;
-	while (quick_bit_len > 0) {
-		context.bytewidth *= 2;
-		quick_bit_len--;
+muResult mu_instruction_set_dynamic_buffer_size(muContext* context, mubInstruction* instruction) {
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
 
-	unsigned char quick_id_len = 
-	(mu_bitcheck(bytecode[4], 4) * 1) + 
-	(mu_bitcheck(bytecode[4], 5) * 2);
-	context.jump_marker_id_byte_len = 1;
-	while (quick_id_len > 0) {
-		context.jump_marker_id_byte_len *= 2;
-		quick_id_len--;
+	if (src_dt.type != MUB_DATA_TYPE_INTEGER) {
+		mu_print("[MUB] Failed to set dynamic buffer size; type passed in for new size was non-integer.\n");
+		return MU_FAILURE;
 	}
-
-	quick_id_len = 
-	(mu_bitcheck(bytecode[4], 2) * 1) + 
-	(mu_bitcheck(bytecode[4], 3) * 2);
-	context.function_id_byte_len = 1;
-	while (quick_id_len > 0) {
-		context.function_id_byte_len *= 2;
-		quick_id_len--;
+	if (src_dt.sign == MUB_DATA_TYPE_SIGNED) {
+		mu_print("[MUB] Failed to set dynamic buffer size; sign of data type for new size is signed.\n");
+		return MU_FAILURE;
 	}
 
-	quick_id_len = 
-	(mu_bitcheck(bytecode[4], 0) * 1) + 
-	(mu_bitcheck(bytecode[4], 1) * 2);
-	context.external_function_id_byte_len = 1;
-	while (quick_id_len > 0) {
-		context.external_function_id_byte_len *= 2;
-		quick_id_len--;
-	}
+	uint64_m reg0_val = mu_context_get_reg_pointer_value(mub_get_register(&context->reg0, src_dt.byte_size), src_dt.byte_size);
 
-	context.static_memory_len = mu_get_uint32_from_bytecode(&bytecode[8]);
-	context.temp_memory_len = mu_get_uint32_from_bytecode(&bytecode[12]);
-	context.dynamic_memory_len = 0;
-	context.dynamic_memory = MU_NULL_PTR;
+	size_m new_len = (size_m)reg0_val;
+	size_m capacity = context->dynamic_memory_capacity;
 
-	context.main_return = 0;
+	// capacity grows geometrically and only shrinks once mostly unused, so that resizing a little at a time takes
+	// amortized constant time
+	size_m new_capacity = capacity;
+	if (new_len > capacity) {
+		new_capacity = (capacity > ((size_m)-1) / 2) ? new_len : capacity * 2;
+		if (new_capacity < new_len) {
+			new_capacity = new_len;
+		}
+	} else if (new_len == 0 || new_len <= capacity / 4) {
+		new_capacity = new_len * 2;
+	}
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	// guarded memory is resized in place, so there's nothing to amortize, and the pages past the length have to stay
+	// inaccessible for accesses past it to fault
+	if (context->memory_reserved > 0) {
+		new_capacity = new_len;
+	}
+	#endif
 
-	context.last_if = MU_FALSE;
+	// memory past the old length may hold what was there before shrinking, so it's zeroed unless freshly allocated
+	muBool zeroed = MU_FALSE;
+	if (new_capacity != capacity && mub_resize_dynamic_memory(context, new_capacity, &zeroed) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
 
-	if (context.static_memory_len > 0) {
-		context.static_memory = mu_malloc(context.static_memory_len * sizeof(muByte));
-		mu_memset(context.static_memory, 0, context.static_memory_len * sizeof(muByte));
-	} else {
-		context.static_memory = MU_NULL_PTR;
+	size_m old_len = context->dynamic_memory_len;
+	context->dynamic_memory_len = new_len;
+	#ifdef MUB_FLAT_MEMORY
+	mub_set_memory_sections(context);
+	#endif
+	if (new_len > old_len && zeroed == MU_FALSE) {
+		mu_memset(context->dynamic_memory + old_len, 0, new_len - old_len);
 	}
 
-	if (context.temp_memory_len > 0) {
-		context.temp_memory = mu_malloc(context.temp_memory_len * sizeof(muByte));
-		mu_memset(context.temp_memory, 0, context.temp_memory_len * sizeof(muByte));
-	} else {
-		context.temp_memory = MU_NULL_PTR;
+	return MU_SUCCESS;
+}
+
+// mem_loc is the already checked location of the destination
+muResult mub_perform_operation(muContext* context, mubInstruction* instruction, muByte* mem_loc) {
+	if (instruction->kernel == MU_NULL_PTR) {
+		mu_print("[MUB] Failed to perform operation; invalid conversion request.\n");
+		return MU_FAILURE;
 	}
+	instruction->kernel(mem_loc, context->reg0.value.bytes, context->reg1.value.bytes);
+	return MU_SUCCESS;
+}
 
-	context.reg0 = MU_NULL_PTR;
-	context.reg1 = MU_NULL_PTR;
-	context.reg2 = MU_NULL_PTR;
+muResult mu_two_operand_instruction(muContext* context, mubInstruction* instruction) {
+	// obtain value from src_dt into reg0 (pointer=0 means we have actual value)
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
 
-	context.bytecode = mu_malloc(bytecode_len * sizeof(muByte));
-	mu_memcpy(context.bytecode, bytecode, bytecode_len * sizeof(muByte));
-	context.bytecode_len = bytecode_len;
+	// obtain address to store at from dst_dt
+	mubDataType dst_dt = instruction->dst.datatype;
+	uint64_m reg1_val = 0;
+	if (mu_context_get_destination_address(context, &instruction->dst, &reg1_val) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
 
-	muByte* step = context.bytecode;
-	context.jump_marker_len = 0;
-	context.function_len = 0;
-	context.external_function_len = 0;
-	context.variable_len = 0;
-	context.jump_markers = MU_NULL_PTR;
-	context.functions = MU_NULL_PTR;
-	context.external_functions = MU_NULL_PTR;
-	context.variables = MU_NULL_PTR;
+	// set memory address point stored in reg1_val to reg0
 
-	muResult res = MU_SUCCESS;
-	while (step < context.bytecode + context.bytecode_len) {
-		if (step[0] == 0xF0) {
-			context.jump_marker_len++;
-		} else if (step[0] == 0xE0) {
-			context.function_len++;
-		} else if (step[0] == 0x12) {
-			context.external_function_len++;
-		} else if (step[0] == 0x11) {
-			context.variable_len++;
-		}
-		step = mub_advance_header(&res, &context, step, context.bytecode, context.bytecode_len, MU_FALSE);
-		if (res == MU_FAILURE) {
-			if (fail_if_invalid_bytecode == MU_TRUE) {
-				mu_print("[MUB] Failed to create context; unrecognized command in bytecode.\n");
-				context = mu_context_destroy(MU_NULL_PTR, context);
-				return context;
-			}
+	if (reg1_val == 0) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
+	}
+	
+	if (
+		(src_dt.type == MUB_DATA_TYPE_VOID || src_dt.type == MUB_DATA_TYPE_STRUCT) ||
+		(dst_dt.type == MUB_DATA_TYPE_VOID || dst_dt.type == MUB_DATA_TYPE_STRUCT)
+	) {
+		// checked as a whole first so that nothing is written if it doesn't fit
+		size_m memory_len = mub_get_memory_len(context, dst_dt.temp);
+		if (dst_dt.byte_size > memory_len || reg1_val > memory_len - dst_dt.byte_size) {
+			mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+			return MU_FAILURE;
+		}
+		size_m len = (src_dt.byte_size < dst_dt.byte_size) ? src_dt.byte_size : dst_dt.byte_size;
+		if (mub_copy_memory(context, reg1_val, mub_get_register(&context->reg0, src_dt.byte_size), len, dst_dt.temp, MU_TRUE) != MU_SUCCESS) {
+			mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+			return MU_FAILURE;
 		}
+		return MU_SUCCESS;
 	}
 	
-	if (context.jump_marker_len > 0 || context.function_len > 0 || context.external_function_len > 0) {
-		if (context.jump_marker_len > 0) {
-			context.jump_markers = mu_malloc(sizeof(muJumpMarker) * context.jump_marker_len);
-		}
-		if (context.function_len > 0) {
-			context.functions = mu_malloc(sizeof(muFunction) * context.function_len);
-		}
-		if (context.external_function_len > 0) {
-			context.external_functions = mu_malloc(sizeof(muExternalFunction) * context.external_function_len);
-		}
-		muByte* new_step = context.bytecode;
-		size_m jump_marker_count = 0;
-		size_m function_count = 0;
-		size_m external_function_count = 0;
-		while (new_step < context.bytecode + context.bytecode_len) {
-			if (new_step[0] == 0xF0) {
-				context.jump_markers[jump_marker_count].bytecode_index = new_step - context.bytecode;
-				switch (context.jump_marker_id_byte_len) { default: break;
-					case 1: context.jump_markers[jump_marker_count].index = mu_get_uint8_from_bytecode(&new_step[1]); break;
-					case 2: context.jump_markers[jump_marker_count].index = mu_get_uint16_from_bytecode(&new_step[1]); break;
-					case 4: context.jump_markers[jump_marker_count].index = mu_get_uint32_from_bytecode(&new_step[1]); break;
-					case 8: context.jump_markers[jump_marker_count].index = mu_get_uint64_from_bytecode(&new_step[1]); break;
-				}
-				jump_marker_count++;
-			} else if (new_step[0] == 0xE0) {
-				context.functions[function_count].bytecode_index = new_step - context.bytecode;
-				switch (context.function_id_byte_len) { default: break;
-					case 1: context.functions[function_count].index = mu_get_uint8_from_bytecode(&new_step[1]); break;
-					case 2: context.functions[function_count].index = mu_get_uint16_from_bytecode(&new_step[1]); break;
-					case 4: context.functions[function_count].index = mu_get_uint32_from_bytecode(&new_step[1]); break;
-					case 8: context.functions[function_count].index = mu_get_uint64_from_bytecode(&new_step[1]); break;
-				}
-				context.functions[function_count].name = MU_NULL_PTR;
-				function_count++;
-			} else if (new_step[0] == 0x12) {
-				context.external_functions[external_function_count].function = MU_NULL_PTR;
-				switch (context.external_function_id_byte_len) { default: break; 
-					case 1: context.external_functions[external_function_count].index = mu_get_uint8_from_bytecode(&new_step[1]); break;
-					case 2: context.external_functions[external_function_count].index = mu_get_uint16_from_bytecode(&new_step[1]); break;
-					case 4: context.external_functions[external_function_count].index = mu_get_uint32_from_bytecode(&new_step[1]); break;
-					case 8: context.external_functions[external_function_count].index = mu_get_uint64_from_bytecode(&new_step[1]); break;
-				}
+	muByte* mem_loc = mub_get_memory_range(context, reg1_val, dst_dt.byte_size, dst_dt.temp);
+	if (mem_loc == MU_NULL_PTR) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
+	}
+	return mub_perform_operation(context, instruction, mem_loc);
+}
 
-				size_m offset = 1 + context.external_function_id_byte_len;
-				size_m namelen = 0;
-				while (new_step + offset + namelen < context.bytecode + context.bytecode_len && new_step[offset+namelen] != '\0') {
-					namelen++;
-				}
-				namelen++;
-				context.external_functions[external_function_count].name = mu_malloc(namelen);
-				namelen = 0;
-				while (new_step + offset + namelen < context.bytecode + context.bytecode_len && new_step[offset+namelen] != '\0') {
-					context.external_functions[external_function_count].name[namelen] = new_step[offset+namelen];
-					namelen++;
-				}
-				context.external_functions[external_function_count].name[namelen] = '\0';
+muResult mu_three_operand_instruction(muContext* context, mubInstruction* instruction) {
+	// obtain value from src0_dt into reg0 (pointer=0 means we have actual value)
+	mubDataType src0_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
 
-				external_function_count++;
-			}
-			new_step = mub_advance_header(MU_NULL_PTR, &context, new_step, context.bytecode, context.bytecode_len, MU_FALSE);
-		}
+	// obtain value from src1_dt into reg1
+	mubDataType src1_dt = instruction->src1.datatype;
+	if (mu_context_fill_reg1_with_operand(context, &instruction->src1) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
 
-	context.variables = mu_malloc(context.variable_len * sizeof(muVariable));
-
-	step = context.bytecode;
-	size_m variable_count = 0;
-	while (step < context.bytecode + context.bytecode_len) {
-		if (step[0] == 0x10) {
-			muByte* original_original_step = step;
-			muByte* original_step = step;
-			step++;
-			size_m index = 0;
-			switch (context.function_id_byte_len) { default: break;
-				case 1: index = mu_get_uint8_from_bytecode(step); break;
-				case 2: index = mu_get_uint16_from_bytecode(step); break;
-				case 4: index = mu_get_uint32_from_bytecode(step); break;
-				case 8: index = mu_get_uint64_from_bytecode(step); break;
-			}
-			step += context.function_id_byte_len;
-			size_m actual_index = 0;
-			muBool found_index = MU_FALSE;
-			if (index < context.function_len && context.functions[index-1].index == index) {
-				actual_index = index-1;
-				found_index = MU_TRUE;
-			} else {
-				for (size_m i = 0; i < context.function_len; i++) {
-					if (context.functions[i].index == index) {
-						actual_index = i;
-						found_index = MU_TRUE;
-						break;
-					}
-				}
-			}
-			if (found_index == MU_FALSE) {
-				step = original_step;
-			} else if (context.functions[actual_index].name == MU_NULL_PTR) {
-				original_step = step;
-				while (step < context.bytecode + context.bytecode_len && step[0] != '\0') {
-					step++;
-				}
-				step++;
-				context.functions[actual_index].name = mu_malloc(step - original_step);
-				step = original_step;
-				while (step < context.bytecode + context.bytecode_len && step[0] != '\0') {
-					context.functions[actual_index].name[step-original_step] = step[0];
-					step++;
-				}
-				context.functions[actual_index].name[step-original_step] = '\0';
-				step = original_original_step;
-			}
-		} else if (step[0] == 0x11) {
-			size_m offset = 1;
-			switch (context.bytewidth) { default: break;
-				case 1: context.variables[variable_count].address = mu_get_uint8_from_bytecode(&step[1]);  offset += 1; break;
-				case 2: context.variables[variable_count].address = mu_get_uint16_from_bytecode(&step[1]); offset += 2; break;
-				case 4: context.variables[variable_count].address = mu_get_uint32_from_bytecode(&step[1]); offset += 4; break;
-				case 8: context.variables[variable_count].address = mu_get_uint64_from_bytecode(&step[1]); offset += 8; break;
-			}
-			context.variables[variable_count].datatype = mu_get_data_type_from_bytecode(&step[offset]);
-			offset += 3;
-
-			size_m namelen = 0;
-			while (step + offset + namelen < context.bytecode + context.bytecode_len && step[offset + namelen] != '\0') {
-				namelen++;
-			}
-			namelen++;
-			context.variables[variable_count].name = mu_malloc(namelen);
-			namelen = 0;
-			while (step + offset + namelen < context.bytecode + context.bytecode_len && step[offset + namelen] != '\0') {
-				context.variables[variable_count].name[namelen] = step[offset + namelen];
-				namelen++;
-			}
-			context.variables[variable_count].name[namelen] = step[offset + namelen];
-			namelen++;
+	// obtain address to store at from dst_dt
+	mubDataType dst_dt = instruction->dst.datatype;
+	uint64_m reg2_val = 0;
+	if (mu_context_get_destination_address(context, &instruction->dst, &reg2_val) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
 
-			variable_count++;
-		}
-		step = mub_advance_header(MU_NULL_PTR, &context, step, context.bytecode, context.bytecode_len, MU_FALSE);
+	// set memory address point stored in reg2_val to reg0 + reg1
+	
+	muByte* mem_loc = mub_get_memory_range(context, reg2_val, dst_dt.byte_size, dst_dt.temp);
+	if (mem_loc == MU_NULL_PTR || reg2_val == 0) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
+	}
+	
+	if (
+		(src0_dt.type == MUB_DATA_TYPE_VOID || src0_dt.type == MUB_DATA_TYPE_STRUCT) ||
+		(src1_dt.type == MUB_DATA_TYPE_VOID || src1_dt.type == MUB_DATA_TYPE_STRUCT) ||
+		(dst_dt.type == MUB_DATA_TYPE_VOID || dst_dt.type == MUB_DATA_TYPE_STRUCT)
+	) {
+		mu_print("[MUB] Invalid mathematical operation.\n");
+		return MU_FAILURE;
 	}
+	
+	return mub_perform_operation(context, instruction, mem_loc);
+}
 
-	context.alive = MU_TRUE;
+// bulk memory commands
 
-	if (result != MU_NULL_PTR) {
-		*result = MU_SUCCESS;
+// how many of len bytes at an address lie in the same allocation as the first; static and dynamic memory are separate
+// allocations unless memory is flat, so a block can be split between them once at most
+size_m mub_get_memory_split(muContext* context, uint64_m index, size_m len, int buffer) {
+	#ifndef MUB_FLAT_MEMORY
+	if (buffer == 0 && index < context->static_memory_len && len > context->static_memory_len - index) {
+		return context->static_memory_len - index;
 	}
-	return context;
+	#else
+	(void)context;
+	(void)index;
+	(void)buffer;
+	#endif
+	return len;
 }
 
-MUDEF muContext mu_context_destroy(muResult* result, muContext context) {
-	if (context.bytecode != MU_NULL_PTR) {
-		mu_free(context.bytecode);
-		context.bytecode = MU_NULL_PTR;
+// the length of a bulk memory command, which has to be an unsigned integer
+muResult mub_get_block_length(muContext* context, mubInstruction* instruction, size_m* len) {
+	mubDataType src_dt = instruction->src0.datatype;
+	if (src_dt.type != MUB_DATA_TYPE_INTEGER || src_dt.sign == MUB_DATA_TYPE_SIGNED) {
+		mu_print("[MUB] Failed to perform memory command; type passed in for length was not an unsigned integer.\n");
+		return MU_FAILURE;
 	}
-
-	if (context.jump_markers != MU_NULL_PTR) {
-		mu_free(context.jump_markers);
-		context.jump_markers = MU_NULL_PTR;
-		context.jump_marker_len = 0;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
-
-	if (context.functions != MU_NULL_PTR) {
-		for (size_m i = 0; i < context.function_len; i++) {
-			if (context.functions[i].name != MU_NULL_PTR) {
-				mu_free(context.functions[i].name);
-				context.functions[i].name = MU_NULL_PTR;
-			}
-		}
-		mu_free(context.functions);
-		context.functions = MU_NULL_PTR;
-		context.function_len = 0;
+	uint64_m reg0_val = mu_context_get_reg_pointer_value(mub_get_register(&context->reg0, src_dt.byte_size), src_dt.byte_size);
+	if (reg0_val > (uint64_m)((size_m)-1)) {
+		mu_print("[MUB] Failed to perform memory command; length is too big.\n");
+		return MU_FAILURE;
 	}
+	*len = (size_m)reg0_val;
+	return MU_SUCCESS;
+}
 
-	if (context.external_functions != MU_NULL_PTR) {
-		for (size_m i = 0; i < context.external_function_len; i++) {
-			if (context.external_functions[i].name != MU_NULL_PTR) {
-				mu_free(context.external_functions[i].name);
-				context.external_functions[i].name = MU_NULL_PTR;
-			}
-		}
-		mu_free(context.external_functions);
-		context.external_functions = MU_NULL_PTR;
-		context.external_function_len = 0;
+// the address of a block of len bytes, checked as a whole; destinations can't be at the null address
+muResult mub_get_block_address(muContext* context, mubOperand* operand, size_m len, muBool destination, uint64_m* address) {
+	if (mu_context_get_destination_address(context, operand, address) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	size_m memory_len = mub_get_memory_len(context, operand->datatype.temp);
+	if ((destination == MU_TRUE && *address == 0) || len > memory_len || *address > memory_len - len) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
 	}
+	return MU_SUCCESS;
+}
 
-	if (context.variables != MU_NULL_PTR) {
-		for (size_m i = 0; i < context.variable_len; i++) {
-			if (context.variables[i].name != MU_NULL_PTR) {
-				mu_free(context.variables[i].name);
-				context.variables[i].name = MU_NULL_PTR;
-			}
+muResult mu_instruction_copy(muContext* context, mubInstruction* instruction) {
+	size_m len = 0;
+	uint64_m src = 0, dst = 0;
+	if (
+		mub_get_block_length(context, instruction, &len) != MU_SUCCESS ||
+		mub_get_block_address(context, &instruction->src1, len, MU_FALSE, &src) != MU_SUCCESS ||
+		mub_get_block_address(context, &instruction->dst, len, MU_TRUE, &dst) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+	int src_buffer = instruction->src1.datatype.temp;
+	int dst_buffer = instruction->dst.datatype.temp;
+
+	// copied in up to 3 chunks that each lie in one allocation on both sides
+	size_m bounds[4] = { 0, mub_get_memory_split(context, src, len, src_buffer), mub_get_memory_split(context, dst, len, dst_buffer), len };
+	if (bounds[1] > bounds[2]) {
+		size_m bound = bounds[1];
+		bounds[1] = bounds[2];
+		bounds[2] = bound;
+	}
+	// blocks can overlap, so a copy to a higher address goes from the end like memmove does
+	muBool backward = (src_buffer == dst_buffer && dst > src) ? MU_TRUE : MU_FALSE;
+	for (size_m i = 0; i < 3; i++) {
+		size_m chunk = (backward == MU_TRUE) ? 2 - i : i;
+		size_m chunk_len = bounds[chunk + 1] - bounds[chunk];
+		if (chunk_len > 0) {
+			mu_memmove(
+				mub_get_memory_range(context, dst + bounds[chunk], chunk_len, dst_buffer),
+				mub_get_memory_range(context, src + bounds[chunk], chunk_len, src_buffer),
+				chunk_len
+			);
 		}
-		mu_free(context.variables);
-		context.variables = MU_NULL_PTR;
-		context.variable_len = 0;
 	}
+	return MU_SUCCESS;
+}
 
-	if (context.static_memory != MU_NULL_PTR) {
-		mu_free(context.static_memory);
-		context.static_memory = MU_NULL_PTR;
-		context.static_memory_len = 0;
+muResult mu_instruction_fill(muContext* context, mubInstruction* instruction) {
+	size_m len = 0;
+	uint64_m dst = 0;
+	if (
+		mub_get_block_length(context, instruction, &len) != MU_SUCCESS ||
+		mu_context_fill_reg1_with_operand(context, &instruction->src1) != MU_SUCCESS ||
+		mub_get_block_address(context, &instruction->dst, len, MU_TRUE, &dst) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
 	}
+	mubDataType src_dt = instruction->src1.datatype;
+	muByte value = (muByte)mu_context_get_reg_pointer_value(mub_get_register(&context->reg1, src_dt.byte_size), src_dt.byte_size);
 
-	if (context.temp_memory != MU_NULL_PTR) {
-		mu_free(context.temp_memory);
-		context.temp_memory = MU_NULL_PTR;
-		context.temp_memory_len = 0;
+	int dst_buffer = instruction->dst.datatype.temp;
+	size_m first_len = mub_get_memory_split(context, dst, len, dst_buffer);
+	if (first_len > 0) {
+		mu_memset(mub_get_memory_range(context, dst, first_len, dst_buffer), value, first_len);
 	}
-
-	if (context.dynamic_memory != MU_NULL_PTR) {
-		mu_free(context.dynamic_memory);
-		context.dynamic_memory = MU_NULL_PTR;
-		context.dynamic_memory_len = 0;
+	if (first_len < len) {
+		mu_memset(mub_get_memory_range(context, dst + first_len, len - first_len, dst_buffer), value, len - first_len);
 	}
+	return MU_SUCCESS;
+}
 
-	if (context.reg0 != MU_NULL_PTR) {
-		mu_free(context.reg0);
-		context.reg0 = MU_NULL_PTR;
+muResult mu_instruction_compare(muContext* context, mubInstruction* instruction) {
+	size_m len = 0;
+	uint64_m address0 = 0, address1 = 0;
+	if (
+		mub_get_block_length(context, instruction, &len) != MU_SUCCESS ||
+		mub_get_block_address(context, &instruction->src1, len, MU_FALSE, &address0) != MU_SUCCESS ||
+		mub_get_block_address(context, &instruction->src2, len, MU_FALSE, &address1) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
 	}
-
-	if (context.reg1 != MU_NULL_PTR) {
-		mu_free(context.reg1);
-		context.reg1 = MU_NULL_PTR;
+	int buffer = instruction->src1.datatype.temp;
+
+	// compared in up to 3 chunks that each lie in one allocation on both sides
+	size_m bounds[4] = { 0, mub_get_memory_split(context, address0, len, buffer), mub_get_memory_split(context, address1, len, buffer), len };
+	if (bounds[1] > bounds[2]) {
+		size_m bound = bounds[1];
+		bounds[1] = bounds[2];
+		bounds[2] = bound;
+	}
+	int result = 0;
+	for (size_m i = 0; i < 3 && result == 0; i++) {
+		size_m chunk_len = bounds[i + 1] - bounds[i];
+		if (chunk_len > 0) {
+			result = mu_memcmp(
+				mub_get_memory_range(context, address0 + bounds[i], chunk_len, buffer),
+				mub_get_memory_range(context, address1 + bounds[i], chunk_len, buffer),
+				chunk_len
+			);
+		}
 	}
 
-	if (context.reg2 != MU_NULL_PTR) {
-		mu_free(context.reg2);
-		context.reg2 = MU_NULL_PTR;
+	// stored like the result of an operation on the signed 1-byte integer -1, 0 or 1
+	mubDataType dst_dt = instruction->dst.datatype;
+	uint64_m dst = 0;
+	if (mu_context_get_destination_address(context, &instruction->dst, &dst) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	muByte* mem_loc = mub_get_memory_range(context, dst, dst_dt.byte_size, dst_dt.temp);
+	if (mem_loc == MU_NULL_PTR || dst == 0) {
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
 	}
+	context->reg0.value.bytes[0] = (muByte)(int8_m)((result > 0) - (result < 0));
+	return mub_perform_operation(context, instruction, mem_loc);
+}
 
-	context.alive = MU_FALSE;
+muResult mu_instruction_move(muContext* context, mubInstruction* instruction) {
+	return mu_two_operand_instruction(context, instruction);
+}
 
-	if (result != MU_NULL_PTR) {
-		*result = MU_SUCCESS;
-	}
+muResult mu_instruction_add(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
 
-	return context;
+muResult mu_instruction_subtract(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
 }
 
-MUDEF int mu_context_execute_main(muResult* result, muContext* context) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to execute main; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return 0;
-	}
-	size_m main_function_id = 0;
-	muBool found_main_function = MU_FALSE;
-	if (context->function_len > 0 && context->functions[context->function_len-1].index == 0) {
-		main_function_id = context->function_len - 1;
-		found_main_function = MU_TRUE;
-	} else {
-		for (size_m i = 0; i < context->function_len; i++) {
-			if (context->functions[i].index == 0) {
-				main_function_id = context->function_len - 1;
-				found_main_function = MU_TRUE;
-				break;
-			}
-		}
-	}
-	if (found_main_function == MU_FALSE) {
-		mu_print("[MUB] Failed to execute main; no main function specified in the bytecode.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return 0;
+muResult mu_instruction_multiply(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_divide(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_modulo(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_not(muContext* context, mubInstruction* instruction) {
+	return mu_two_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_and(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_or(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_xor(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_lshift(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_bw_rshift(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_equal(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_not_equal(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_less(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_less_equal(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_greater(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_cond_greater_equal(muContext* context, mubInstruction* instruction) {
+	return mu_three_operand_instruction(context, instruction);
+}
+
+muResult mu_instruction_if(muContext* context, mubInstruction* instruction) {
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
 
-	muByte* step = &context->bytecode[context->functions[main_function_id].bytecode_index];
-	while (step < context->bytecode + context->bytecode_len) {
-		if (step[0] == 0xE1) {
-			break;
-		}
-		muBool ifCheck = MU_FALSE;
-		if (step[0] == 0xA0) {
-			ifCheck = MU_TRUE;
-		}
-		if (mub_execute_command(context, step) != MU_SUCCESS) {
-			if (result != MU_NULL_PTR) {
-				*result = MU_FAILURE;
-			}
-			return 0;
-		}
-		if ((ifCheck && context->last_if == MU_FALSE) || step[0] == 0xA2) {
-			size_m if_count = 1;
-			while (if_count != 0 && step < context->bytecode + context->bytecode_len) {
-				step = mub_advance_header(MU_NULL_PTR, context, step, context->bytecode, context->bytecode_len, MU_FALSE);
-				if (step[0] == 0xA0 || step[0] == 0xA2) {
-					if_count++;
-				} else if (step[0] == 0xA1) {
-					if_count--;
-				}
-			}
-			if (step[1] == 0xA2) {
-				step += 2;
-			}
-		} else {
-			if (step[0] == 0x00) {
-				return context->main_return;
-			}
-			step = mub_advance_header(MU_NULL_PTR, context, step, context->bytecode, context->bytecode_len, MU_TRUE);
+	muByte* reg0 = mub_get_register(&context->reg0, src_dt.byte_size);
+	context->last_if = MU_FALSE;
+	for (size_m i = 0; i < src_dt.byte_size; i++) {
+		if (reg0[i] != 0) {
+			context->last_if = MU_TRUE;
 		}
 	}
 
-	if (result != MU_NULL_PTR) {
-		*result = MU_SUCCESS;
+	return MU_SUCCESS;
+}
+
+// where the value of an operand that skips checks is; its immediate, or a constant place in static or temporary memory
+muByte* mub_get_verified_operand(muContext* context, mubOperand* operand) {
+	if (operand->datatype.pointer_count == 0) {
+		return operand->immediate;
 	}
+	return ((operand->datatype.temp == 0) ? context->static_memory : context->temp_memory) + operand->address;
+}
 
-	return 0;
+// where the destination of an operation that skips checks is
+muByte* mub_get_verified_destination(muContext* context, mubOperand* operand) {
+	return ((operand->datatype.temp == 0) ? context->static_memory : context->temp_memory) + operand->address;
 }
 
-MUDEF void mu_context_execute_function(muResult* result, muContext* context, size_m id) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to execute function; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return;
+// sources still go through the registers, which are aligned for the kernels
+void mub_verified_operation(muContext* context, mubInstruction* instruction) {
+	mu_memcpy(context->reg0.value.bytes, mub_get_verified_operand(context, &instruction->src0), instruction->src0.datatype.byte_size);
+	if (instruction->command != 0x80 && instruction->command != 0x86) {
+		mu_memcpy(context->reg1.value.bytes, mub_get_verified_operand(context, &instruction->src1), instruction->src1.datatype.byte_size);
 	}
-	if (id == 0) {
-		mu_print("[MUB] Failed to execute function; ID #0 (aka main) cannot be executed via the \"execute function\" function, the \"execute main\" function needs to be used.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
+	instruction->kernel(mub_get_verified_destination(context, &instruction->dst), context->reg0.value.bytes, context->reg1.value.bytes);
+}
+
+muBool mub_verified_if(muContext* context, mubInstruction* instruction) {
+	muByte* value = mub_get_verified_operand(context, &instruction->src0);
+	context->last_if = MU_FALSE;
+	for (size_m i = 0; i < instruction->src0.datatype.byte_size; i++) {
+		if (value[i] != 0) {
+			context->last_if = MU_TRUE;
+			break;
 		}
-		return;
 	}
-	size_m actual_index = 0;
-	muBool found_index = MU_FALSE;
-	if (id < context->function_len && context->functions[id-1].index == id) {
-		actual_index = id-1;
-		found_index = MU_TRUE;
-	} else {
-		for (size_m i = 0; i < context->function_len; i++) {
-			if (context->functions[i].index == id) {
-				actual_index = i;
-				found_index = MU_TRUE;
-				break;
-			}
+	return context->last_if;
+}
+
+// calls are made on the context's frame stack rather than the C stack
+muResult mub_push_frame(muContext* context, size_m return_index) {
+	if (context->frame_len == context->frame_capacity) {
+		if (context->frame_capacity >= MUB_MAX_CALL_DEPTH) {
+			mu_print("[MUB] Failed to call function; maximum call depth exceeded.\n");
+			return MU_FAILURE;
 		}
-	}
-	if (found_index == MU_FALSE) {
-		mu_print("[MUB] Failed to execute function; no function has the given ID.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
+		size_m frame_capacity = (context->frame_capacity == 0) ? 16 : (context->frame_capacity * 2);
+		if (frame_capacity > MUB_MAX_CALL_DEPTH) {
+			frame_capacity = MUB_MAX_CALL_DEPTH;
 		}
-		return;
-	}
-	if (result != MU_NULL_PTR) {
-		*result = mub_execute_function(context, &context->bytecode[context->functions[actual_index].bytecode_index]);
-	} else {
-		mub_execute_function(context, &context->bytecode[context->functions[actual_index].bytecode_index]);
+		size_m* frames = mub_reallocate(&context->allocator, context->frames, sizeof(size_m) * context->frame_capacity, sizeof(size_m) * frame_capacity);
+		if (frames == MU_NULL_PTR) {
+			mu_print("[MUB] Failed to call function; realloc call failed.\n");
+			return MU_FAILURE;
+		}
+		context->frames = frames;
+		context->frame_capacity = frame_capacity;
 	}
+	context->frames[context->frame_len] = return_index;
+	context->frame_len++;
+	return MU_SUCCESS;
 }
 
-MUDEF size_m mu_context_get_function_id(muResult* result, muContext* context, const char* name) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to get function id; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return 0;
+// pushes a frame returning to the instruction after the call and gives the first instruction of the called function
+muResult mu_instruction_call_function(muContext* context, mubInstruction* instruction, size_m* index) {
+	if (instruction->target < context->program->instruction_len) {
+		*index = instruction->target;
+		return mub_push_frame(context, instruction->next);
 	}
-	for (size_m i = 0; i < context->function_len; i++) {
-		if (context->functions[i].name != MU_NULL_PTR && mu_strcmp(name, context->functions[i].name) == 0) {
-			if (result != MU_NULL_PTR) {
-				*result = MU_SUCCESS;
-			}
-			return context->functions[i].index;
-		}
+
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
-	mu_print("[MUB] Failed to get function id; no function name matches.\n");
-	if (result != MU_NULL_PTR) {
-		*result = MU_FAILURE;
+
+	uint64_m reg0_val = mu_context_get_reg_pointer_value(mub_get_register(&context->reg0, src_dt.byte_size), src_dt.byte_size);
+	size_m function_index = 0;
+	if (mub_id_table_find(&context->program->function_table, reg0_val, &function_index) == MU_TRUE) {
+		*index = context->program->functions[function_index].instruction_index;
+		return mub_push_frame(context, instruction->next);
 	}
-	return 0;
+	mu_print("[MUB] WARNING! Unrecognized function ID when executing bytecode. Bytecode may not execute properly.\n");
+	return MU_FAILURE;
 }
 
-MUDEF muVariable mu_context_get_variable(muResult* result, muContext* context, const char* name) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to get variable; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		muVariable variable = {0};
-		return variable;
+muResult mu_instruction_call_external_function(muContext* context, mubInstruction* instruction) {
+	mubDataType src_dt = instruction->src0.datatype;
+	if (mu_context_fill_reg0_with_operand(context, &instruction->src0) != MU_SUCCESS) {
+		return MU_FAILURE;
 	}
-	for (size_m i = 0; i < context->variable_len; i++) {
-		if (context->variables[i].name != MU_NULL_PTR && mu_strcmp(name, context->variables[i].name) == 0) {
-			if (result != MU_NULL_PTR) {
-				*result = MU_SUCCESS;
-			}
-			return context->variables[i];
-		}
+
+	uint64_m reg0_val = mu_context_get_reg_pointer_value(mub_get_register(&context->reg0, src_dt.byte_size), src_dt.byte_size);
+	size_m index = 0;
+	if (mub_id_table_find(&context->program->external_function_table, reg0_val, &index) == MU_FALSE) {
+		mu_print("[MUB] Failed to call external function; could not find external function with specified index.\n");
+		return MU_FAILURE;
 	}
-	mu_print("[MUB] Failed to get variable; no variable with the given name could found.\n");
-	if (result != MU_NULL_PTR) {
-		*result = MU_FAILURE;
+
+	if (context->external_functions[index] == MU_NULL_PTR) {
+		mu_print("[MUB] Failed to call external function; specified external function has no function associated with it.\n");
+		return MU_FAILURE;
 	}
-	muVariable variable = {0};
-	return variable;
+	context->external_functions[index](context);
+	return MU_SUCCESS;
 }
 
-MUDEF void mu_context_get_variable_data(muResult* result, muContext* context, muVariable variable, void* data) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to get variable data; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return;
-	}
-	muByte* location = mu_context_get_memory_location(context, variable.address, variable.datatype.temp);
-	if (location == MU_NULL_PTR || 
-		mu_context_get_memory_location(context, variable.address + variable.datatype.byte_size - 1, variable.datatype.temp) == MU_NULL_PTR
-	) {
-		mu_print("[MUB] Failed to get variable data; memory address location is out of range.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return;
+size_m mub_get_step_from_data_type(muProgram* program, muByte* bytecode) {
+	size_m step = 3;
+	mubDataType dt0 = mu_get_data_type_from_bytecode(bytecode);
+	if (dt0.pointer_count > 0) {
+		step += program->bytewidth;
+	} else {
+		step += dt0.byte_size;
 	}
-	mu_memcpy(data, location, variable.datatype.byte_size);
-	if (result != MU_NULL_PTR) {
-		*result = MU_SUCCESS;
+	return step;
+}
+
+muByte* mub_advance_header(muResult* res, muProgram* program, muByte* bytecode, muByte* bytecode_beginning, size_m bytecode_len) {
+	if (res != MU_NULL_PTR) {
+		*res = MU_SUCCESS;
+	}
+	switch (bytecode[0]) {
+		case 0x00: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1); return bytecode; break;
+		case 0x01: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1) + 1; return bytecode; break;
+		case 0x02: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1); return bytecode; break;
+		case 0x03: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1) + (3 + program->bytewidth) * 2; return bytecode; break;
+		case 0x04: bytecode += 1 + 3 + ((mub_get_step_from_data_type(program, bytecode+1) - 3) * 2) + 3 + program->bytewidth; return bytecode; break;
+		case 0x05: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1) + 3 + program->bytewidth * 2 + 3 + program->bytewidth; return bytecode; break;
+		// name setters
+		case 0x10: bytecode++; bytecode += program->function_id_byte_len; while (bytecode < bytecode_beginning + bytecode_len && bytecode[0] != '\0') { bytecode++; } bytecode++; return bytecode; break;
+		case 0x11: bytecode++; bytecode += program->bytewidth; bytecode += 3; while (bytecode < bytecode_beginning + bytecode_len && bytecode[0] != '\0') { bytecode++; } bytecode++; return bytecode; break;
+		case 0x12: bytecode++; bytecode += program->external_function_id_byte_len; while (bytecode < bytecode_beginning + bytecode_len && bytecode[0] != '\0') { bytecode++; } bytecode++; return bytecode; break;
+		// beginning stuff
+		case 0x6D: if (bytecode == bytecode_beginning) { return bytecode + 16; } break;
+		// end stuff
+		case 0x65: if (bytecode + 4 == bytecode_beginning + bytecode_len) { return bytecode + 4; } break;
+		// commands
+		case 0x80: case 0x86: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1) + 3 + (program->bytewidth); return bytecode; break;
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: {
+			bytecode += 1 + 3 + ((mub_get_step_from_data_type(program, bytecode+1) - 3) * 2);
+			bytecode += 3 + program->bytewidth; 
+			return bytecode;
+		} break;
+		// functions
+		case 0xE0: bytecode++; bytecode += program->function_id_byte_len; return bytecode; break;
+		case 0xE1: bytecode++; return bytecode; break;
+		case 0xE2: bytecode++; return bytecode; break;
+		case 0xE3: case 0xE4: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1); return bytecode; break;
+		// jump markers
+		case 0xF0: bytecode++; bytecode += program->jump_marker_id_byte_len; return bytecode; break;
+		case 0xF1: bytecode++; bytecode += program->jump_marker_id_byte_len; return bytecode; break;
+		// other stuff
+		case 0xA0: bytecode += 1 + mub_get_step_from_data_type(program, bytecode+1); return bytecode; break;
+		case 0xA1: bytecode++; return bytecode; break;
+		case 0xA2: bytecode++; return bytecode; break;
+	}
+	if (res != MU_NULL_PTR) {
+		*res = MU_FAILURE;
 	}
+	mu_print("[MUB] WARNING! Unrecognized command found when scanning bytecode. Bytecode may not execute properly.\n");
+	return bytecode + 1;
 }
 
-MUDEF void mu_context_set_variable_data(muResult* result, muContext* context, muVariable variable, void* data) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to set variable data; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return;
+// decoding
+
+muByte* mub_decode_operand_value(muProgram* program, muByte* bytecode, mubDataType datatype, mubOperand* operand) {
+	operand->datatype = datatype;
+	operand->bytecode_index = bytecode - program->bytecode;
+	if (datatype.pointer_count > 0) {
+		operand->address = mu_context_get_reg_pointer_value(bytecode, program->bytewidth);
+		return bytecode + program->bytewidth;
 	}
-	muByte* location = mu_context_get_memory_location(context, variable.address, variable.datatype.temp);
-	if (location == MU_NULL_PTR || 
-		mu_context_get_memory_location(context, variable.address + variable.datatype.byte_size - 1, variable.datatype.temp) == MU_NULL_PTR
-	) {
-		mu_print("[MUB] Failed to set variable data; memory address location is out of range.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
-		}
-		return;
+	if (datatype.byte_size <= sizeof(operand->immediate)) {
+		mu_memcpy(operand->immediate, bytecode, datatype.byte_size);
 	}
-	mu_memcpy(location, data, variable.datatype.byte_size);
-	if (result != MU_NULL_PTR) {
-		*result = MU_SUCCESS;
+	return bytecode + datatype.byte_size;
+}
+
+muByte* mub_decode_operand(muProgram* program, muByte* bytecode, mubOperand* operand) {
+	return mub_decode_operand_value(program, bytecode + 3, mu_get_data_type_from_bytecode(bytecode), operand);
+}
+
+// destination values are always addresses, no matter the dereference count
+muByte* mub_decode_destination_operand(muProgram* program, muByte* bytecode, mubOperand* operand) {
+	operand->datatype = mu_get_data_type_from_bytecode(bytecode);
+	bytecode += 3;
+	operand->bytecode_index = bytecode - program->bytecode;
+	operand->address = mu_context_get_reg_pointer_value(bytecode, program->bytewidth);
+	return bytecode + program->bytewidth;
+}
+
+muByte mub_get_instruction_handler(muByte command) {
+	switch (command) { default: break;
+	case 0x00: return MUB_HANDLER_RETURN_MAIN; break;
+	case 0x01: return MUB_HANDLER_PRINT; break;
+	case 0x02: return MUB_HANDLER_SET_DYNAMIC_BUFFER_SIZE; break;
+	case 0x03: return MUB_HANDLER_COPY; break;
+	case 0x04: return MUB_HANDLER_FILL; break;
+	case 0x05: return MUB_HANDLER_COMPARE; break;
+	case 0x80: return MUB_HANDLER_MOVE; break;
+	case 0x81: return MUB_HANDLER_ADD; break;
+	case 0x82: return MUB_HANDLER_SUBTRACT; break;
+	case 0x83: return MUB_HANDLER_MULTIPLY; break;
+	case 0x84: return MUB_HANDLER_DIVIDE; break;
+	case 0x85: return MUB_HANDLER_MODULO; break;
+	case 0x86: return MUB_HANDLER_BW_NOT; break;
+	case 0x87: return MUB_HANDLER_BW_AND; break;
+	case 0x88: return MUB_HANDLER_BW_OR; break;
+	case 0x89: return MUB_HANDLER_BW_XOR; break;
+	case 0x8A: return MUB_HANDLER_BW_LSHIFT; break;
+	case 0x8B: return MUB_HANDLER_BW_RSHIFT; break;
+	case 0x90: return MUB_HANDLER_COND_EQUAL; break;
+	case 0x91: return MUB_HANDLER_COND_NOT_EQUAL; break;
+	case 0x92: return MUB_HANDLER_COND_LESS; break;
+	case 0x93: return MUB_HANDLER_COND_LESS_EQUAL; break;
+	case 0x94: return MUB_HANDLER_COND_GREATER; break;
+	case 0x95: return MUB_HANDLER_COND_GREATER_EQUAL; break;
+	case 0xA0: return MUB_HANDLER_IF; break;
+	case 0xE1: return MUB_HANDLER_END_FUNCTION; break;
+	case 0xE2: return MUB_HANDLER_RETURN; break;
+	case 0xE3: return MUB_HANDLER_CALL_FUNCTION; break;
+	case 0xE4: return MUB_HANDLER_CALL_EXTERNAL_FUNCTION; break;
+	// else and jump commands only change the next instruction, which is resolved when the program is created
+	case 0x10: case 0x11: case 0x12: case 0xA1: case 0xA2: case 0xE0: case 0xF0: case 0xF1: return MUB_HANDLER_NEXT; break;
 	}
+	return MUB_HANDLER_UNKNOWN;
 }
 
-MUDEF void mu_context_set_external_function(muResult* result, muContext* context, const char* name, void(*function)(muContext* context)) {
-	if (context->alive == MU_FALSE) {
-		mu_print("[MUB] Failed to set external function; given context is not valid.\n");
-		if (result != MU_NULL_PTR) {
-			*result = MU_FAILURE;
+mubOperationKernel mub_get_instruction_kernel(mubInstruction* instruction) {
+	switch (instruction->command) { default: break;
+		case 0x80: return mub_get_operation_kernel(MUB_OPERATION_MOVE, instruction->src0.datatype, instruction->dst.datatype); break;
+		// compares produce a signed 1-byte integer
+		case 0x05: {
+			mubDataType result_dt = { MUB_DATA_TYPE_SIGNED, MUB_DATA_TYPE_INTEGER, 0, 0, 1 };
+			return mub_get_operation_kernel(MUB_OPERATION_MOVE, result_dt, instruction->dst.datatype);
+		} break;
+		case 0x86: return mub_get_operation_kernel(MUB_OPERATION_BW_NOT, instruction->src0.datatype, instruction->dst.datatype); break;
+		// 0x81-0x8B and 0x90-0x95 are numbered in the same order as the operations
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+			return mub_get_operation_kernel(instruction->command - 0x80, instruction->src0.datatype, instruction->dst.datatype); break;
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95:
+			return mub_get_operation_kernel(instruction->command - 0x90 + MUB_OPERATION_COND_EQUAL, instruction->src0.datatype, instruction->dst.datatype); break;
+	}
+	return MU_NULL_PTR;
+}
+
+void mub_decode_instruction(muProgram* program, muByte* bytecode, mubInstruction* instruction) {
+	muByte* step = bytecode + 1;
+	instruction->command = bytecode[0];
+	instruction->handler = mub_get_instruction_handler(instruction->command);
+	instruction->bytecode_index = bytecode - program->bytecode;
+	switch (instruction->command) { default: break;
+		case 0x00: case 0x02: case 0xA0: case 0xE3: case 0xE4: mub_decode_operand(program, step, &instruction->src0); break;
+		case 0x01: step = mub_decode_operand(program, step, &instruction->src0); instruction->spec = step[0]; break;
+		case 0x03: {
+			step = mub_decode_operand(program, step, &instruction->src0);
+			step = mub_decode_destination_operand(program, step, &instruction->src1);
+			mub_decode_destination_operand(program, step, &instruction->dst);
+		} break;
+		case 0x04: {
+			step = mub_decode_operand(program, step, &instruction->src0);
+			// the length and the value share the first data type
+			step = mub_decode_operand_value(program, step, instruction->src0.datatype, &instruction->src1);
+			mub_decode_destination_operand(program, step, &instruction->dst);
+		} break;
+		case 0x05: {
+			step = mub_decode_operand(program, step, &instruction->src0);
+			// both addresses share one data type
+			step = mub_decode_destination_operand(program, step, &instruction->src1);
+			instruction->src2.datatype = instruction->src1.datatype;
+			instruction->src2.address = mu_context_get_reg_pointer_value(step, program->bytewidth);
+			step += program->bytewidth;
+			mub_decode_destination_operand(program, step, &instruction->dst);
+		} break;
+		case 0x80: case 0x86: {
+			step = mub_decode_operand(program, step, &instruction->src0);
+			mub_decode_destination_operand(program, step, &instruction->dst);
+		} break;
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: {
+			step = mub_decode_operand(program, step, &instruction->src0);
+			// both sources share the first data type
+			step = mub_decode_operand_value(program, step, instruction->src0.datatype, &instruction->src1);
+			mub_decode_destination_operand(program, step, &instruction->dst);
+		} break;
+		case 0xE0: instruction->id = mu_context_get_reg_pointer_value(step, program->function_id_byte_len); break;
+		case 0xF0: case 0xF1: instruction->id = mu_context_get_reg_pointer_value(step, program->jump_marker_id_byte_len); break;
+	}
+	instruction->kernel = mub_get_instruction_kernel(instruction);
+}
+
+// matches every if/else with its end so that skipping one is a single jump; conditionals still waiting for their end
+// are kept as a stack linked through their skip indexes, so nothing has to be allocated
+void mub_resolve_conditionals(muProgram* program, size_m begin, size_m end) {
+	mubInstruction* instructions = program->instructions;
+	// instruction_len is the bottom of the stack, no instruction in the range has it as an index
+	size_m open = program->instruction_len;
+	for (size_m i = begin; i < end; i++) {
+		muByte command = instructions[i].command;
+		if (command == 0xA0 || command == 0xA2) {
+			instructions[i].skip = open;
+			open = i;
+		} else if (command == 0xA1 && open != program->instruction_len) {
+			size_m below = instructions[open].skip;
+			size_m skip = i;
+			// an else directly after the end is entered when its if is skipped
+			if (i + 1 < end && instructions[i+1].command == 0xA2) {
+				skip = i + 2;
+			}
+			instructions[open].skip = skip;
+			open = below;
 		}
-		return;
 	}
-	for (size_m i = 0; i < context->external_function_len; i++) {
-		if (context->external_functions[i].name != MU_NULL_PTR && mu_strcmp(name, context->external_functions[i].name) == 0) {
-			context->external_functions[i].function = (void(*)(void* context))function;
-			if (result != MU_NULL_PTR) {
-				*result = MU_SUCCESS;
+	// skipped conditionals with no end skip past the end of the code
+	while (open != program->instruction_len) {
+		size_m below = instructions[open].skip;
+		instructions[open].skip = program->instruction_len;
+		open = below;
+	}
+
+	// reaching an else means its if was executed, so it's always skipped
+	for (size_m i = begin; i < end; i++) {
+		if (program->instructions[i].command == 0xA2) {
+			program->instructions[i].next = program->instructions[i].skip;
+		}
+	}
+}
+
+// resolves conditionals, jumps and constant function calls now that every jump marker and function has an instruction
+void mub_resolve_instructions(muProgram* program, size_m begin, size_m end) {
+	mub_resolve_conditionals(program, begin, end);
+
+	for (size_m i = begin; i < end; i++) {
+		mubInstruction* instruction = &program->instructions[i];
+		size_m index = 0;
+		if (instruction->command == 0xF1) {
+			if (mub_id_table_find(&program->jump_marker_table, instruction->id, &index) == MU_TRUE) {
+				instruction->next = program->jump_markers[index].instruction_index;
+			}
+		} else if (instruction->command == 0xE3) {
+			instruction->target = program->instruction_len;
+			mubDataType src_dt = instruction->src0.datatype;
+			if (src_dt.pointer_count == 0 && src_dt.byte_size <= 8 &&
+				mub_id_table_find(&program->function_table, mu_context_get_reg_pointer_value(instruction->src0.immediate, src_dt.byte_size), &index) == MU_TRUE
+			) {
+				instruction->target = program->functions[index].instruction_index;
 			}
-			return;
 		}
 	}
-	mu_print("[MUB] Failed to set external function; no external function with the given name could be found specified within the bytecode.\n");
-	if (result != MU_NULL_PTR) {
-		*result = MU_FAILURE;
+}
+
+// verification
+
+// follows the "invalid" data type rules; types other than integers and decimals are always valid
+muBool mub_is_data_type_valid(mubDataType datatype) {
+	if (datatype.type == MUB_DATA_TYPE_INTEGER) {
+		return (datatype.byte_size == 1 || datatype.byte_size == 2 || datatype.byte_size == 4 || datatype.byte_size == 8) ? MU_TRUE : MU_FALSE;
+	}
+	if (datatype.type == MUB_DATA_TYPE_DECIMAL) {
+		return (datatype.sign == MUB_DATA_TYPE_SIGNED && (datatype.byte_size == 4 || datatype.byte_size == 8)) ? MU_TRUE : MU_FALSE;
 	}
+	return MU_TRUE;
 }
 
-MUDEF muByte mu_string_to_binary(const char* s) {
-	muByte i = 0;
-	while (*s) {
-		i <<= 1;
-		i += *s++ - '0';
+// whether len bytes at a constant address always lie within static or temporary memory
+muBool mub_is_constant_range_valid(muProgram* program, uint64_m address, size_m len, muByte temp) {
+	uint64_m memory_len = (temp == 0) ? program->static_memory_len : program->temp_memory_len;
+	return (address <= memory_len && len <= memory_len - address) ? MU_TRUE : MU_FALSE;
+}
+
+// whether a source operand is an immediate or read straight from a constant place in static or temporary memory
+muBool mub_is_source_constant(muProgram* program, mubOperand* operand) {
+	mubDataType datatype = operand->datatype;
+	if (datatype.byte_size > sizeof(operand->immediate)) {
+		return MU_FALSE;
 	}
-	return i;
+	if (datatype.pointer_count == 0) {
+		return MU_TRUE;
+	}
+	return (datatype.pointer_count == 1 && mub_is_constant_range_valid(program, operand->address, datatype.byte_size, datatype.temp) == MU_TRUE) ? MU_TRUE : MU_FALSE;
 }
 
-muResult mub_perform_operation(muContext* context, mubDataType src0_dt, mubDataType src1_dt, mubDataType dst_dt, int operation, int64_m reg1_val, int64_m reg2_val) {
-	muByte* mem_loc = mu_context_get_memory_location(context, reg1_val, dst_dt.temp);
-	if (mem_loc == MU_NULL_PTR) {
-		mu_print("[MUB] Failed to perform operation; invalid memory address.\n");
-		return MU_FAILURE;
+// whether a destination operand is a constant place in static or temporary memory other than the null address
+muBool mub_is_destination_constant(muProgram* program, mubOperand* operand) {
+	mubDataType datatype = operand->datatype;
+	return (datatype.pointer_count == 0 && operand->address != 0 && mub_is_constant_range_valid(program, operand->address, datatype.byte_size, datatype.temp) == MU_TRUE) ? MU_TRUE : MU_FALSE;
+}
+
+// whether an instruction can be executed without any checks, as everything it touches is known to be valid
+muBool mub_can_skip_checks(muProgram* program, mubInstruction* instruction) {
+	switch (instruction->command) { default: break;
+		case 0x80: case 0x86:
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: {
+			muBool three_operands = (instruction->command != 0x80 && instruction->command != 0x86) ? MU_TRUE : MU_FALSE;
+			return (
+				instruction->kernel != MU_NULL_PTR &&
+				mub_is_source_constant(program, &instruction->src0) == MU_TRUE &&
+				(three_operands == MU_FALSE || mub_is_source_constant(program, &instruction->src1) == MU_TRUE) &&
+				mub_is_destination_constant(program, &instruction->dst) == MU_TRUE
+			) ? MU_TRUE : MU_FALSE;
+		} break;
+		case 0xA0: return mub_is_source_constant(program, &instruction->src0); break;
 	}
-	switch (operation) { default: break; 
-		case MUB_OPERATION_MOVE: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+	return MU_FALSE;
+}
+
+// whether an instruction can't fail for any reason known before it's executed
+muBool mub_is_instruction_valid(muProgram* program, mubInstruction* instruction) {
+	size_m index = 0;
+	mubDataType src_dt = instruction->src0.datatype;
+	switch (instruction->command) { default: break;
+		case 0x00: case 0x01: case 0xA0: return mub_is_data_type_valid(src_dt); break;
+		case 0x02: case 0x03: case 0x04: return (src_dt.type == MUB_DATA_TYPE_INTEGER && src_dt.sign == MUB_DATA_TYPE_UNSIGNED && mub_is_data_type_valid(src_dt) == MU_TRUE) ? MU_TRUE : MU_FALSE; break;
+		case 0x05: return (src_dt.type == MUB_DATA_TYPE_INTEGER && src_dt.sign == MUB_DATA_TYPE_UNSIGNED && mub_is_data_type_valid(src_dt) == MU_TRUE && instruction->kernel != MU_NULL_PTR) ? MU_TRUE : MU_FALSE; break;
+		case 0xE3: {
+			if (src_dt.pointer_count == 0) {
+				return (instruction->target < program->instruction_len) ? MU_TRUE : MU_FALSE;
 			}
+			return mub_is_data_type_valid(src_dt);
 		} break;
-		case MUB_OPERATION_ADD: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) + *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) + *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) + *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) + *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) + *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) + *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) + *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) + *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) + *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) + *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+		case 0xE4: {
+			if (src_dt.pointer_count == 0) {
+				return (src_dt.byte_size <= 8 && mub_id_table_find(&program->external_function_table, mu_context_get_reg_pointer_value(instruction->src0.immediate, src_dt.byte_size), &index) == MU_TRUE) ? MU_TRUE : MU_FALSE;
 			}
+			return mub_is_data_type_valid(src_dt);
 		} break;
-		case MUB_OPERATION_SUBTRACT: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) - *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) - *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) - *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) - *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) - *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) - *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) - *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) - *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) - *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) - *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_MULTIPLY: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) * *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) * *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) * *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) * *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) * *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) * *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) * *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) * *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) * *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) * *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+		case 0x80: case 0x86:
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: {
+			mubDataType dst_dt = instruction->dst.datatype;
+			if (mub_is_data_type_valid(src_dt) == MU_FALSE || mub_is_data_type_valid(dst_dt) == MU_FALSE) {
+				return MU_FALSE;
 			}
-		} break;
-		case MUB_OPERATION_DIVIDE: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) / *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) / *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) / *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) / *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) / *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) / *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) / *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) / *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) / *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) / *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			// constant destinations outside of temporary memory or at the null address always fail
+			if (dst_dt.pointer_count == 0 && (instruction->dst.address == 0 || (dst_dt.temp != 0 && mub_is_constant_range_valid(program, instruction->dst.address, dst_dt.byte_size, dst_dt.temp) == MU_FALSE))) {
+				return MU_FALSE;
 			}
-		} break;
-		case MUB_OPERATION_MODULO: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) % *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) % *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) % *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) % *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) % *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) % *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) % *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) % *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) % *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) % *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			// only moves can be between voids and structs, the rest need a kernel
+			muBool untyped = (
+				src_dt.type == MUB_DATA_TYPE_VOID || src_dt.type == MUB_DATA_TYPE_STRUCT ||
+				dst_dt.type == MUB_DATA_TYPE_VOID || dst_dt.type == MUB_DATA_TYPE_STRUCT
+			) ? MU_TRUE : MU_FALSE;
+			if (untyped == MU_TRUE) {
+				return (instruction->command == 0x80 || instruction->command == 0x86) ? MU_TRUE : MU_FALSE;
 			}
+			return (instruction->kernel != MU_NULL_PTR) ? MU_TRUE : MU_FALSE;
 		} break;
-		case MUB_OPERATION_BW_NOT: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((uint8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((int8_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((uint16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((int16_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((uint32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((int32_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((float*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int8_m*)mem_loc) = (int8_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int16_m*)mem_loc) = (int16_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int32_m*)mem_loc) = (int32_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((float*)mem_loc) = (float)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((float*)mem_loc) = (float)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((uint64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((int64_m*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((int64_m*)mem_loc) = (int64_m)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((double*)mem_loc) = (double)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED: { *((double*)mem_loc) = (double)(~*((double*)&context->reg0[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+	}
+	return (instruction->handler != MUB_HANDLER_UNKNOWN) ? MU_TRUE : MU_FALSE;
+}
+
+// checks the function declared at the given instruction once, before it's ever executed: every command has to be
+// known and valid, conditionals and the declaration itself balanced, and every jump and constant call has to lead
+// somewhere; its instructions that can then skip their checks are moved onto handlers that do
+muBool mub_verify_function(muProgram* program, size_m begin) {
+	if (begin >= program->instruction_len || program->instructions[begin].command != 0xE0) {
+		return MU_FALSE;
+	}
+
+	size_m end = begin + 1;
+	size_m depth = 0;
+	for (;; end++) {
+		if (end >= program->instruction_len) {
+			return MU_FALSE;
+		}
+		mubInstruction* instruction = &program->instructions[end];
+		if (instruction->command == 0xE0) {
+			return MU_FALSE;
+		}
+		if (instruction->command == 0xE1) {
+			break;
+		}
+		if (mub_is_instruction_valid(program, instruction) == MU_FALSE) {
+			return MU_FALSE;
+		}
+		if (instruction->command == 0xA0) {
+			depth++;
+		} else if (instruction->command == 0xA2) {
+			// an else has to come right after the end of its if
+			if (program->instructions[end - 1].command != 0xA1) {
+				return MU_FALSE;
 			}
-		} break;
-		case MUB_OPERATION_BW_AND: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) & *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) & *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) & *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) & *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) & *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) & *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) & *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) & *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) & *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) & *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			depth++;
+		} else if (instruction->command == 0xA1) {
+			if (depth == 0) {
+				return MU_FALSE;
 			}
-		} break;
-		case MUB_OPERATION_BW_OR: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) | *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) | *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) | *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) | *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) | *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) | *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) | *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) | *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) | *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) | *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_BW_XOR: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) ^ *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) ^ *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) ^ *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) ^ *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) ^ *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) ^ *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) ^ *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) ^ *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) ^ *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) ^ *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_BW_LSHIFT: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) << *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) << *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) << *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) << *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) << *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) << *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) << *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) << *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) << *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) << *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_BW_RSHIFT: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) >> *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) >> *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) >> *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) >> *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) >> *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) >> *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) >> *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) >> *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) >> *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														//case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) >> *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_COND_EQUAL: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) == *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) == *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) == *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) == *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) == *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) == *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) == *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) == *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) == *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) == *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			depth--;
+		}
+	}
+	if (depth != 0) {
+		return MU_FALSE;
+	}
+
+	// jumps have to stay within the function
+	for (size_m i = begin + 1; i < end; i++) {
+		size_m index = 0;
+		if (program->instructions[i].command == 0xF1 && (
+			mub_id_table_find(&program->jump_marker_table, program->instructions[i].id, &index) == MU_FALSE ||
+			program->jump_markers[index].instruction_index <= begin || program->jump_markers[index].instruction_index >= end
+		)) {
+			return MU_FALSE;
+		}
+	}
+
+	for (size_m i = begin + 1; i < end; i++) {
+		mubInstruction* instruction = &program->instructions[i];
+		if (mub_can_skip_checks(program, instruction) == MU_TRUE) {
+			instruction->handler = (instruction->command == 0xA0) ? MUB_HANDLER_VERIFIED_IF : MUB_HANDLER_VERIFIED_OPERATION;
+		}
+	}
+	return MU_TRUE;
+}
+
+// decodes a range of a lazy program if it hasn't been yet; contexts on other threads may be executing the rest of the
+// program, but only reach the range through its lazy entries, which all call this first
+muResult mub_prepare_range(muProgram* program, size_m range_index) {
+	mubLazyRange* range = &program->lazy_ranges[range_index];
+	long state = MUB_ATOMIC_LOAD(&range->state);
+	if (state == MUB_RANGE_DECODED) {
+		return MU_SUCCESS;
+	}
+	if (MUB_ATOMIC_CAS(&range->state, MUB_RANGE_UNDECODED, MUB_RANGE_DECODING)) {
+		muByte* step = program->bytecode + range->bytecode_index;
+		for (size_m i = range->begin; i < range->end; i++) {
+			// jump markers are lazy entries, decoded along with the function declarations
+			if (step[0] != 0xF0) {
+				mubInstruction* instruction = &program->instructions[i];
+				mu_memset(instruction, 0, sizeof(mubInstruction));
+				mub_decode_instruction(program, step, instruction);
+				instruction->next = i + 1;
 			}
-		} break;
-		case MUB_OPERATION_COND_NOT_EQUAL: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) != *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) != *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) != *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) != *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) != *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) != *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) != *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) != *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) != *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) != *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-			}
-		} break;
-		case MUB_OPERATION_COND_LESS: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) < *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) < *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) < *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) < *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) < *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) < *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) < *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) < *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) < *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) < *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			step = mub_advance_header(MU_NULL_PTR, program, step, program->bytecode, program->bytecode_len);
+		}
+		mub_resolve_instructions(program, range->begin, range->end);
+		// every range but the first is the body of a function
+		if (range->begin > 0) {
+			mub_verify_function(program, range->begin - 1);
+		}
+		MUB_ATOMIC_STORE(&range->state, MUB_RANGE_DECODED);
+		return MU_SUCCESS;
+	}
+	// another thread is decoding it, which only takes as long as decoding the function
+	state = MUB_ATOMIC_LOAD(&range->state);
+	while (state == MUB_RANGE_DECODING) {
+		MUB_YIELD();
+		state = MUB_ATOMIC_LOAD(&range->state);
+	}
+	return (state == MUB_RANGE_DECODED) ? MU_SUCCESS : MU_FAILURE;
+}
+
+// size of the values that a command loads into reg0 and reg1, read straight from the bytecode
+void mub_get_command_load_sizes(muByte* bytecode, size_m* src0_size, size_m* src1_size) {
+	*src0_size = 0;
+	*src1_size = 0;
+	switch (bytecode[0]) { default: break;
+		case 0x00: case 0x01: case 0x02: case 0x03: case 0x05: case 0x80: case 0x86: case 0xA0: case 0xE3: case 0xE4:
+			*src0_size = mu_get_data_type_from_bytecode(&bytecode[1]).byte_size;
+			break;
+		// both sources share the first data type
+		case 0x04:
+		case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95:
+			*src0_size = mu_get_data_type_from_bytecode(&bytecode[1]).byte_size;
+			*src1_size = *src0_size;
+			break;
+	}
+}
+
+// makes room for element len of a growable array, doubling its capacity when full
+muResult mub_reserve(void** array, size_m* capacity, size_m len, size_m element_size, const muAllocator* allocator) {
+	if (len < *capacity) {
+		return MU_SUCCESS;
+	}
+	size_m new_capacity = (*capacity == 0) ? 16 : (*capacity * 2);
+	while (new_capacity <= len) {
+		new_capacity *= 2;
+	}
+	void* new_array = mub_reallocate(allocator, *array, element_size * *capacity, element_size * new_capacity);
+	if (new_array == MU_NULL_PTR) {
+		return MU_FAILURE;
+	}
+	*array = new_array;
+	*capacity = new_capacity;
+	return MU_SUCCESS;
+}
+
+// copies a null-terminated name out of the bytecode, stopping at the end of the bytecode if it's unterminated;
+// MU_NULL_PTR if the name can't be allocated
+char* mub_copy_name(muByte* bytecode, muByte* bytecode_end, const muAllocator* allocator) {
+	size_m namelen = 0;
+	while (bytecode + namelen < bytecode_end && bytecode[namelen] != '\0') {
+		namelen++;
+	}
+	char* name = mub_allocate(allocator, namelen + 1);
+	if (name == MU_NULL_PTR) {
+		return MU_NULL_PTR;
+	}
+	mu_memcpy(name, bytecode, namelen);
+	name[namelen] = '\0';
+	return name;
+}
+
+void mub_free_function_names(mubFunctionName* function_names, size_m function_name_len, const muAllocator* allocator) {
+	if (function_names == MU_NULL_PTR) {
+		return;
+	}
+	for (size_m i = 0; i < function_name_len; i++) {
+		if (function_names[i].name != MU_NULL_PTR) {
+			mub_deallocate(allocator, function_names[i].name);
+		}
+	}
+	mub_deallocate(allocator, function_names);
+}
+
+// runs instructions from the given index until the end of the function; each handler picks the next
+// instruction and dispatches to it directly. main_return is only given for main, which doesn't stop
+// at return commands, but does stop at a return main command
+muResult mub_execute_instructions(muContext* context, size_m index, int32_m* main_return) {
+	mubInstruction* instructions = context->program->instructions;
+	mubInstruction* instruction = &instructions[index];
+	// frames below this belong to whoever is running this function
+	size_m base_frame = context->frame_len;
+
+#ifdef MUB_COMPUTED_GOTO
+	static void* handlers[MUB_HANDLER_COUNT] = {
+		&&handler_unknown, &&handler_end_of_code, &&handler_next, &&handler_return_main, &&handler_print,
+		&&handler_set_dynamic_buffer_size, &&handler_copy, &&handler_fill, &&handler_compare, &&handler_move,
+		&&handler_add, &&handler_subtract,
+		&&handler_multiply, &&handler_divide, &&handler_modulo, &&handler_bw_not, &&handler_bw_and,
+		&&handler_bw_or, &&handler_bw_xor, &&handler_bw_lshift, &&handler_bw_rshift, &&handler_cond_equal,
+		&&handler_cond_not_equal, &&handler_cond_less, &&handler_cond_less_equal, &&handler_cond_greater,
+		&&handler_cond_greater_equal, &&handler_if, &&handler_end_function, &&handler_return,
+		&&handler_call_function, &&handler_call_external_function, &&handler_lazy_entry,
+		&&handler_verified_operation, &&handler_verified_if
+	};
+	#define MUB_HANDLER(label, handler) label:
+	#define MUB_DISPATCH() goto *handlers[instruction->handler]
+	#define MUB_DISPATCH_BEGIN MUB_DISPATCH();
+	#define MUB_DISPATCH_END
+#else
+	#define MUB_HANDLER(label, handler) case handler:
+	#define MUB_DISPATCH() continue
+	#define MUB_DISPATCH_BEGIN for (;;) { switch (instruction->handler) { default:
+	#define MUB_DISPATCH_END } }
+#endif
+
+	#define MUB_NEXT(next_index) instruction = &instructions[next_index]; MUB_DISPATCH()
+	#define MUB_EXECUTE(function) if (function(context, instruction) != MU_SUCCESS) { return MU_FAILURE; } MUB_NEXT(instruction->next)
+	#define MUB_RETURN_FROM_CALL() context->frame_len--; MUB_NEXT(context->frames[context->frame_len])
+
+	MUB_DISPATCH_BEGIN
+
+	MUB_HANDLER(handler_unknown, MUB_HANDLER_UNKNOWN)
+		mu_print("[MUB] WARNING! Unrecognized command when executing. Bytecode may not execute properly.\n");
+		return MU_FAILURE;
+
+	// the record after the last instruction
+	MUB_HANDLER(handler_end_of_code, MUB_HANDLER_END_OF_CODE)
+		if (main_return != MU_NULL_PTR && context->frame_len == base_frame) {
+			return MU_SUCCESS;
+		}
+		mu_print("[MUB] Failed to execute function; no end to the function was found.\n");
+		return MU_FAILURE;
+
+	MUB_HANDLER(handler_next, MUB_HANDLER_NEXT)
+		MUB_NEXT(instruction->next);
+
+	MUB_HANDLER(handler_return_main, MUB_HANDLER_RETURN_MAIN)
+		if (mu_instruction_return_main(context, instruction) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+		if (main_return != MU_NULL_PTR && context->frame_len == base_frame) {
+			*main_return = context->main_return;
+			return MU_SUCCESS;
+		}
+		MUB_NEXT(instruction->next);
+
+	MUB_HANDLER(handler_print, MUB_HANDLER_PRINT) MUB_EXECUTE(mu_instruction_print);
+	MUB_HANDLER(handler_set_dynamic_buffer_size, MUB_HANDLER_SET_DYNAMIC_BUFFER_SIZE) MUB_EXECUTE(mu_instruction_set_dynamic_buffer_size);
+	MUB_HANDLER(handler_copy, MUB_HANDLER_COPY) MUB_EXECUTE(mu_instruction_copy);
+	MUB_HANDLER(handler_fill, MUB_HANDLER_FILL) MUB_EXECUTE(mu_instruction_fill);
+	MUB_HANDLER(handler_compare, MUB_HANDLER_COMPARE) MUB_EXECUTE(mu_instruction_compare);
+	MUB_HANDLER(handler_move, MUB_HANDLER_MOVE) MUB_EXECUTE(mu_instruction_move);
+	MUB_HANDLER(handler_add, MUB_HANDLER_ADD) MUB_EXECUTE(mu_instruction_add);
+	MUB_HANDLER(handler_subtract, MUB_HANDLER_SUBTRACT) MUB_EXECUTE(mu_instruction_subtract);
+	MUB_HANDLER(handler_multiply, MUB_HANDLER_MULTIPLY) MUB_EXECUTE(mu_instruction_multiply);
+	MUB_HANDLER(handler_divide, MUB_HANDLER_DIVIDE) MUB_EXECUTE(mu_instruction_divide);
+	MUB_HANDLER(handler_modulo, MUB_HANDLER_MODULO) MUB_EXECUTE(mu_instruction_modulo);
+	MUB_HANDLER(handler_bw_not, MUB_HANDLER_BW_NOT) MUB_EXECUTE(mu_instruction_bw_not);
+	MUB_HANDLER(handler_bw_and, MUB_HANDLER_BW_AND) MUB_EXECUTE(mu_instruction_bw_and);
+	MUB_HANDLER(handler_bw_or, MUB_HANDLER_BW_OR) MUB_EXECUTE(mu_instruction_bw_or);
+	MUB_HANDLER(handler_bw_xor, MUB_HANDLER_BW_XOR) MUB_EXECUTE(mu_instruction_bw_xor);
+	MUB_HANDLER(handler_bw_lshift, MUB_HANDLER_BW_LSHIFT) MUB_EXECUTE(mu_instruction_bw_lshift);
+	MUB_HANDLER(handler_bw_rshift, MUB_HANDLER_BW_RSHIFT) MUB_EXECUTE(mu_instruction_bw_rshift);
+	MUB_HANDLER(handler_cond_equal, MUB_HANDLER_COND_EQUAL) MUB_EXECUTE(mu_instruction_cond_equal);
+	MUB_HANDLER(handler_cond_not_equal, MUB_HANDLER_COND_NOT_EQUAL) MUB_EXECUTE(mu_instruction_cond_not_equal);
+	MUB_HANDLER(handler_cond_less, MUB_HANDLER_COND_LESS) MUB_EXECUTE(mu_instruction_cond_less);
+	MUB_HANDLER(handler_cond_less_equal, MUB_HANDLER_COND_LESS_EQUAL) MUB_EXECUTE(mu_instruction_cond_less_equal);
+	MUB_HANDLER(handler_cond_greater, MUB_HANDLER_COND_GREATER) MUB_EXECUTE(mu_instruction_cond_greater);
+	MUB_HANDLER(handler_cond_greater_equal, MUB_HANDLER_COND_GREATER_EQUAL) MUB_EXECUTE(mu_instruction_cond_greater_equal);
+
+	MUB_HANDLER(handler_if, MUB_HANDLER_IF)
+		if (mu_instruction_if(context, instruction) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+		if (context->last_if == MU_FALSE) {
+			MUB_NEXT(instruction->skip);
+		}
+		MUB_NEXT(instruction->next);
+
+	MUB_HANDLER(handler_end_function, MUB_HANDLER_END_FUNCTION)
+		if (context->frame_len > base_frame) {
+			MUB_RETURN_FROM_CALL();
+		}
+		return MU_SUCCESS;
+
+	MUB_HANDLER(handler_return, MUB_HANDLER_RETURN)
+		if (context->frame_len > base_frame) {
+			MUB_RETURN_FROM_CALL();
+		}
+		if (main_return != MU_NULL_PTR) {
+			MUB_NEXT(instruction->next);
+		}
+		return MU_SUCCESS;
+
+	MUB_HANDLER(handler_call_function, MUB_HANDLER_CALL_FUNCTION)
+		if (mu_instruction_call_function(context, instruction, &index) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+		MUB_NEXT(index);
+
+	MUB_HANDLER(handler_call_external_function, MUB_HANDLER_CALL_EXTERNAL_FUNCTION) MUB_EXECUTE(mu_instruction_call_external_function);
+
+	MUB_HANDLER(handler_lazy_entry, MUB_HANDLER_LAZY_ENTRY)
+		if (mub_prepare_range(context->program, instruction->target) != MU_SUCCESS) {
+			mu_print("[MUB] Failed to execute function; function could not be decoded.\n");
+			return MU_FAILURE;
+		}
+		MUB_NEXT(instruction->next);
+
+	MUB_HANDLER(handler_verified_operation, MUB_HANDLER_VERIFIED_OPERATION)
+		mub_verified_operation(context, instruction);
+		MUB_NEXT(instruction->next);
+
+	MUB_HANDLER(handler_verified_if, MUB_HANDLER_VERIFIED_IF)
+		if (mub_verified_if(context, instruction) == MU_FALSE) {
+			MUB_NEXT(instruction->skip);
+		}
+		MUB_NEXT(instruction->next);
+
+	MUB_DISPATCH_END
+
+	#undef MUB_RETURN_FROM_CALL
+	#undef MUB_EXECUTE
+	#undef MUB_NEXT
+	#undef MUB_DISPATCH_END
+	#undef MUB_DISPATCH_BEGIN
+	#undef MUB_DISPATCH
+	#undef MUB_HANDLER
+}
+
+#ifdef MUB_GUARD_PAGE_MEMORY
+// executes instructions with faults in the context's reservation failing the execution
+muResult mub_execute_guarded_instructions(muContext* context, size_m index, int32_m* main_return) {
+	mubGuard guard;
+	guard.context = context;
+	guard.previous = mub_guard_current;
+	if (sigsetjmp(guard.jump, 0) != 0) {
+		mub_guard_current = guard.previous;
+		mu_print("[MUB] WARNING! Invalid memory address modification attempt!\n");
+		return MU_FAILURE;
+	}
+	mub_guard_current = &guard;
+	muResult result = mub_execute_instructions(context, index, main_return);
+	mub_guard_current = guard.previous;
+	return result;
+}
+#endif
+
+muResult mub_execute_function(muContext* context, size_m index, int32_m* main_return) {
+	size_m base_frame = context->frame_len;
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	muResult result = (context->memory_reserved > 0) ? mub_execute_guarded_instructions(context, index, main_return) : mub_execute_instructions(context, index, main_return);
+	#else
+	muResult result = mub_execute_instructions(context, index, main_return);
+	#endif
+	// a failure can happen anywhere in the call stack
+	context->frame_len = base_frame;
+	return result;
+}
+
+/* functions */
+
+// program images
+
+#define MUB_IMAGE_VERSION 3
+// marks a missing name in an image
+#define MUB_IMAGE_NO_NAME ((uint64_m)-1)
+
+void mub_image_get_header(mubImageHeader* header) {
+	mu_memset(header, 0, sizeof(mubImageHeader));
+	header->signature[0] = 'm';
+	header->signature[1] = 'u';
+	header->signature[2] = 'b';
+	header->signature[3] = 'i';
+	header->version = MUB_IMAGE_VERSION;
+	header->byte_order = 0x01020304;
+	header->size_m_size = sizeof(size_m);
+	header->instruction_size = sizeof(mubInstruction);
+	header->function_size = sizeof(muFunction);
+	header->external_function_size = sizeof(muExternalFunction);
+	header->jump_marker_size = sizeof(muJumpMarker);
+	header->variable_size = sizeof(muVariable);
+}
+
+// writes past the end of the image are skipped but still counted, so the needed length is always known
+void mub_image_write(muByte* image, size_m image_len, size_m* offset, const void* data, size_m len) {
+	if (image != MU_NULL_PTR && len > 0 && *offset <= image_len && len <= image_len - *offset) {
+		mu_memcpy(image + *offset, data, len);
+	}
+	*offset += len;
+}
+
+void mub_image_write_size(muByte* image, size_m image_len, size_m* offset, size_m value) {
+	uint64_m value64 = value;
+	mub_image_write(image, image_len, offset, &value64, sizeof(uint64_m));
+}
+
+void mub_image_write_name(muByte* image, size_m image_len, size_m* offset, const char* name) {
+	if (name == MU_NULL_PTR) {
+		mub_image_write_size(image, image_len, offset, MUB_IMAGE_NO_NAME);
+		return;
+	}
+	size_m namelen = 0;
+	while (name[namelen] != '\0') {
+		namelen++;
+	}
+	mub_image_write_size(image, image_len, offset, namelen);
+	mub_image_write(image, image_len, offset, name, namelen);
+}
+
+void mub_image_write_id_table(muByte* image, size_m image_len, size_m* offset, mubIdTable* table) {
+	mub_image_write_size(image, image_len, offset, table->slot_len);
+	mub_image_write_size(image, image_len, offset, (table->ids != MU_NULL_PTR) ? 1 : 0);
+	mub_image_write(image, image_len, offset, table->slots, sizeof(size_m) * table->slot_len);
+	if (table->ids != MU_NULL_PTR) {
+		mub_image_write(image, image_len, offset, table->ids, sizeof(uint64_m) * table->slot_len);
+	}
+}
+
+void mub_image_write_name_table(muByte* image, size_m image_len, size_m* offset, mubNameTable* table) {
+	mub_image_write_size(image, image_len, offset, table->slot_len);
+	mub_image_write(image, image_len, offset, table->slots, sizeof(size_m) * table->slot_len);
+	mub_image_write(image, image_len, offset, table->hashes, sizeof(uint64_m) * table->slot_len);
+}
+
+// records are copied field by field into zeroed memory before being written, so that an image never holds whatever
+// happened to be in their padding
+void mub_image_copy_data_type(mubDataType* copy, mubDataType datatype) {
+	mu_memset(copy, 0, sizeof(mubDataType));
+	copy->sign = datatype.sign;
+	copy->type = datatype.type;
+	copy->temp = datatype.temp;
+	copy->pointer_count = datatype.pointer_count;
+	copy->byte_size = datatype.byte_size;
+}
+
+void mub_image_copy_operand(mubOperand* copy, mubOperand* operand) {
+	mu_memset(copy, 0, sizeof(mubOperand));
+	mub_image_copy_data_type(&copy->datatype, operand->datatype);
+	copy->address = operand->address;
+	mu_memcpy(copy->immediate, operand->immediate, sizeof(operand->immediate));
+	copy->bytecode_index = operand->bytecode_index;
+}
+
+// kernels are left null, as they're looked up again when the image is loaded
+void mub_image_copy_instruction(mubInstruction* copy, mubInstruction* instruction) {
+	mu_memset(copy, 0, sizeof(mubInstruction));
+	copy->command = instruction->command;
+	copy->handler = instruction->handler;
+	copy->bytecode_index = instruction->bytecode_index;
+	copy->next = instruction->next;
+	copy->skip = instruction->skip;
+	copy->id = instruction->id;
+	copy->target = instruction->target;
+	mub_image_copy_operand(&copy->src0, &instruction->src0);
+	mub_image_copy_operand(&copy->src1, &instruction->src1);
+	mub_image_copy_operand(&copy->src2, &instruction->src2);
+	mub_image_copy_operand(&copy->dst, &instruction->dst);
+	copy->spec = instruction->spec;
+}
+
+muResult mub_image_read(muByte* image, size_m image_len, size_m* offset, void* data, size_m len) {
+	if (len > image_len - *offset) {
+		return MU_FAILURE;
+	}
+	mu_memcpy(data, image + *offset, len);
+	*offset += len;
+	return MU_SUCCESS;
+}
+
+muResult mub_image_read_size(muByte* image, size_m image_len, size_m* offset, size_m* value) {
+	uint64_m value64 = 0;
+	if (mub_image_read(image, image_len, offset, &value64, sizeof(uint64_m)) != MU_SUCCESS || value64 != (size_m)value64) {
+		return MU_FAILURE;
+	}
+	*value = (size_m)value64;
+	return MU_SUCCESS;
+}
+
+// allocates len elements if the rest of the image could hold them, or leaves the array null if there are none
+muResult mub_image_allocate_array(size_m image_len, size_m offset, void** array, size_m len, size_m element_size, const muAllocator* allocator) {
+	*array = MU_NULL_PTR;
+	if (len == 0) {
+		return MU_SUCCESS;
+	}
+	if (len > (image_len - offset) / element_size) {
+		return MU_FAILURE;
+	}
+	*array = mub_allocate(allocator, len * element_size);
+	if (*array == MU_NULL_PTR) {
+		return MU_FAILURE;
+	}
+	mu_memset(*array, 0, len * element_size);
+	return MU_SUCCESS;
+}
+
+muResult mub_image_read_array(muByte* image, size_m image_len, size_m* offset, void** array, size_m len, size_m element_size, const muAllocator* allocator) {
+	if (mub_image_allocate_array(image_len, *offset, array, len, element_size, allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	if (len == 0) {
+		return MU_SUCCESS;
+	}
+	return mub_image_read(image, image_len, offset, *array, len * element_size);
+}
+
+muResult mub_image_read_name(muByte* image, size_m image_len, size_m* offset, char** name, const muAllocator* allocator) {
+	*name = MU_NULL_PTR;
+	uint64_m namelen = 0;
+	if (mub_image_read(image, image_len, offset, &namelen, sizeof(uint64_m)) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	if (namelen == MUB_IMAGE_NO_NAME) {
+		return MU_SUCCESS;
+	}
+	if (namelen > image_len - *offset) {
+		return MU_FAILURE;
+	}
+	*name = mub_allocate(allocator, (size_m)namelen + 1);
+	if (*name == MU_NULL_PTR) {
+		return MU_FAILURE;
+	}
+	mub_image_read(image, image_len, offset, *name, (size_m)namelen);
+	(*name)[namelen] = '\0';
+	return MU_SUCCESS;
+}
+
+muResult mub_image_read_id_table(muByte* image, size_m image_len, size_m* offset, mubIdTable* table, size_m array_len, const muAllocator* allocator) {
+	size_m hashed = 0;
+	if (mub_image_read_size(image, image_len, offset, &table->slot_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, offset, &hashed) != MU_SUCCESS ||
+		mub_image_read_array(image, image_len, offset, (void**)&table->slots, table->slot_len, sizeof(size_m), allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+	if (hashed != 0) {
+		if ((table->slot_len & (table->slot_len - 1)) != 0 ||
+			mub_image_read_array(image, image_len, offset, (void**)&table->ids, table->slot_len, sizeof(uint64_m), allocator) != MU_SUCCESS
+		) {
+			return MU_FAILURE;
+		}
+	}
+	for (size_m i = 0; i < table->slot_len; i++) {
+		if (table->slots[i] > array_len) {
+			return MU_FAILURE;
+		}
+	}
+	return MU_SUCCESS;
+}
+
+// names aren't stored in the image's name tables, so they're pointed at the names read for the array
+muResult mub_image_read_name_table(muByte* image, size_m image_len, size_m* offset, mubNameTable* table, void* array, size_m element_size, size_m name_offset, size_m array_len, const muAllocator* allocator) {
+	if (mub_image_read_size(image, image_len, offset, &table->slot_len) != MU_SUCCESS ||
+		(table->slot_len & (table->slot_len - 1)) != 0 ||
+		mub_image_read_array(image, image_len, offset, (void**)&table->slots, table->slot_len, sizeof(size_m), allocator) != MU_SUCCESS ||
+		mub_image_read_array(image, image_len, offset, (void**)&table->hashes, table->slot_len, sizeof(uint64_m), allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+	if (table->slot_len == 0) {
+		return MU_SUCCESS;
+	}
+	table->names = mub_allocate(allocator, sizeof(const char*) * table->slot_len);
+	if (table->names == MU_NULL_PTR) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < table->slot_len; i++) {
+		table->names[i] = MU_NULL_PTR;
+		if (table->slots[i] > array_len) {
+			return MU_FAILURE;
+		}
+		if (table->slots[i] != 0) {
+			table->names[i] = *(char**)((muByte*)array + element_size * (table->slots[i] - 1) + name_offset);
+			if (table->names[i] == MU_NULL_PTR) {
+				return MU_FAILURE;
 			}
-		} break;
-		case MUB_OPERATION_COND_LESS_EQUAL: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) <= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) <= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) <= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) <= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) <= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) <= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) <= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) <= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) <= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) <= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+		}
+	}
+	return MU_SUCCESS;
+}
+
+// reads the beginning header into a program whose bytecode holds at least MU_BEGINNING_HEADER_LENGTH bytes
+// lazy programs only decode function declarations and jump markers up front, see mub_prepare_range
+muResult mub_program_begin(muProgram* program, mubProgramScan* scan, muBool lazy) {
+	muByte* bytecode = program->bytecode;
+
+	unsigned char quick_bit_len = 
+	(mu_bitcheck(bytecode[4], 6) * 1) + 
+	(mu_bitcheck(bytecode[4], 7) * 2);
+	program->bytewidth = 1;
+	while (quick_bit_len > 0) {
+		program->bytewidth *= 2;
+		quick_bit_len--;
+	}
+
+	unsigned char quick_id_len = 
+	(mu_bitcheck(bytecode[4], 4) * 1) + 
+	(mu_bitcheck(bytecode[4], 5) * 2);
+	program->jump_marker_id_byte_len = 1;
+	while (quick_id_len > 0) {
+		program->jump_marker_id_byte_len *= 2;
+		quick_id_len--;
+	}
+
+	quick_id_len = 
+	(mu_bitcheck(bytecode[4], 2) * 1) + 
+	(mu_bitcheck(bytecode[4], 3) * 2);
+	program->function_id_byte_len = 1;
+	while (quick_id_len > 0) {
+		program->function_id_byte_len *= 2;
+		quick_id_len--;
+	}
+
+	quick_id_len = 
+	(mu_bitcheck(bytecode[4], 0) * 1) + 
+	(mu_bitcheck(bytecode[4], 1) * 2);
+	program->external_function_id_byte_len = 1;
+	while (quick_id_len > 0) {
+		program->external_function_id_byte_len *= 2;
+		quick_id_len--;
+	}
+
+	program->static_memory_len = mu_get_uint32_from_bytecode(&bytecode[8]);
+	program->temp_memory_len = mu_get_uint32_from_bytecode(&bytecode[12]);
+	program->reg0_spill_len = 0;
+	program->reg1_spill_len = 0;
+
+	program->jump_marker_len = 0;
+	program->function_len = 0;
+	program->external_function_len = 0;
+	program->variable_len = 0;
+	program->jump_markers = MU_NULL_PTR;
+	program->functions = MU_NULL_PTR;
+	program->external_functions = MU_NULL_PTR;
+	program->variables = MU_NULL_PTR;
+
+	program->instruction_len = 0;
+	program->instructions = MU_NULL_PTR;
+
+	mu_memset(scan, 0, sizeof(mubProgramScan));
+	scan->lazy = lazy;
+	scan->code_overrun = MU_FALSE;
+	scan->function_names = MU_NULL_PTR;
+
+	program->lazy_ranges = MU_NULL_PTR;
+	program->lazy_range_len = 0;
+	if (lazy == MU_TRUE) {
+		if (mub_reserve((void**)&program->lazy_ranges, &scan->lazy_range_capacity, 0, sizeof(mubLazyRange), &program->allocator) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+		program->lazy_ranges[0].begin = 0;
+		program->lazy_ranges[0].bytecode_index = MU_BEGINNING_HEADER_LENGTH;
+		program->lazy_ranges[0].state = MUB_RANGE_UNDECODED;
+		program->lazy_range_len = 1;
+	}
+	return MU_SUCCESS;
+}
+
+// collects the command from step_index to next_step_index into the program's tables, decoding it if it's part of the code;
+// code_end_index is where the end header begins, or anywhere past the command if that isn't known yet
+muResult mub_program_scan_command(muProgram* program, mubProgramScan* scan, size_m step_index, size_m next_step_index, size_m code_end_index) {
+	// one extra record marks the end of the code
+	if (mub_reserve((void**)&program->instructions, &scan->instruction_capacity, program->instruction_len + 1, sizeof(mubInstruction), &program->allocator) != MU_SUCCESS ||
+		mub_reserve((void**)&program->jump_markers, &scan->jump_marker_capacity, program->jump_marker_len, sizeof(muJumpMarker), &program->allocator) != MU_SUCCESS ||
+		mub_reserve((void**)&program->functions, &scan->function_capacity, program->function_len, sizeof(muFunction), &program->allocator) != MU_SUCCESS ||
+		mub_reserve((void**)&program->external_functions, &scan->external_function_capacity, program->external_function_len, sizeof(muExternalFunction), &program->allocator) != MU_SUCCESS ||
+		mub_reserve((void**)&program->variables, &scan->variable_capacity, program->variable_len, sizeof(muVariable), &program->allocator) != MU_SUCCESS ||
+		mub_reserve((void**)&scan->function_names, &scan->function_name_capacity, scan->function_name_len, sizeof(mubFunctionName), &program->allocator) != MU_SUCCESS ||
+		(scan->lazy == MU_TRUE && mub_reserve((void**)&program->lazy_ranges, &scan->lazy_range_capacity, program->lazy_range_len, sizeof(mubLazyRange), &program->allocator) != MU_SUCCESS)
+	) {
+		return MU_FAILURE;
+	}
+
+	muByte* step = program->bytecode + step_index;
+
+	// commands that don't fit before the end header aren't executed
+	size_m instruction_index = 0;
+	if (step_index >= MU_BEGINNING_HEADER_LENGTH && step_index < code_end_index && scan->code_overrun == MU_FALSE) {
+		if (next_step_index > code_end_index) {
+			scan->code_overrun = MU_TRUE;
+		} else {
+			instruction_index = program->instruction_len;
+			program->instruction_len++;
+
+			// size the spill buffers for the biggest value any instruction loads so that executing never allocates
+			size_m src0_size = 0;
+			size_m src1_size = 0;
+			mub_get_command_load_sizes(step, &src0_size, &src1_size);
+			if (src0_size > sizeof(((mubRegister*)0)->value) && src0_size > program->reg0_spill_len) {
+				program->reg0_spill_len = src0_size;
+			}
+			if (src1_size > sizeof(((mubRegister*)0)->value) && src1_size > program->reg1_spill_len) {
+				program->reg1_spill_len = src1_size;
+			}
+
+			if (scan->lazy == MU_FALSE || step[0] == 0xE0 || step[0] == 0xF0) {
+				mubInstruction* instruction = &program->instructions[instruction_index];
+				mu_memset(instruction, 0, sizeof(mubInstruction));
+				mub_decode_instruction(program, step, instruction);
+				instruction->next = instruction_index + 1;
+			}
+			if (scan->lazy == MU_TRUE && (step[0] == 0xE0 || step[0] == 0xF0)) {
+				if (step[0] == 0xE0) {
+					program->lazy_ranges[program->lazy_range_len - 1].end = instruction_index;
+					mubLazyRange* range = &program->lazy_ranges[program->lazy_range_len];
+					range->begin = instruction_index + 1;
+					range->bytecode_index = next_step_index;
+					range->state = MUB_RANGE_UNDECODED;
+					program->lazy_range_len++;
+				}
+				program->instructions[instruction_index].handler = MUB_HANDLER_LAZY_ENTRY;
+				program->instructions[instruction_index].target = program->lazy_range_len - 1;
+			}
+		}
+	}
+
+	if (step[0] == 0xF0) {
+		muJumpMarker* jump_marker = &program->jump_markers[program->jump_marker_len];
+		jump_marker->bytecode_index = step_index;
+		jump_marker->index = mu_context_get_reg_pointer_value(&step[1], program->jump_marker_id_byte_len);
+		jump_marker->instruction_index = instruction_index;
+		program->jump_marker_len++;
+	} else if (step[0] == 0xE0) {
+		muFunction* function = &program->functions[program->function_len];
+		function->bytecode_index = step_index;
+		function->index = mu_context_get_reg_pointer_value(&step[1], program->function_id_byte_len);
+		function->instruction_index = instruction_index;
+		function->name = MU_NULL_PTR;
+		program->function_len++;
+	} else if (step[0] == 0x12) {
+		muExternalFunction* external_function = &program->external_functions[program->external_function_len];
+		external_function->index = mu_context_get_reg_pointer_value(&step[1], program->external_function_id_byte_len);
+		external_function->name = mub_copy_name(step + 1 + program->external_function_id_byte_len, program->bytecode + program->bytecode_len, &program->allocator);
+		if (external_function->name == MU_NULL_PTR) {
+			return MU_FAILURE;
+		}
+		program->external_function_len++;
+	} else if (step[0] == 0x11) {
+		muVariable* variable = &program->variables[program->variable_len];
+		variable->address = mu_context_get_reg_pointer_value(&step[1], program->bytewidth);
+		variable->datatype = mu_get_data_type_from_bytecode(&step[1 + program->bytewidth]);
+		variable->name = mub_copy_name(step + 1 + program->bytewidth + 3, program->bytecode + program->bytecode_len, &program->allocator);
+		if (variable->name == MU_NULL_PTR) {
+			return MU_FAILURE;
+		}
+		program->variable_len++;
+	} else if (step[0] == 0x10) {
+		mubFunctionName* function_name = &scan->function_names[scan->function_name_len];
+		function_name->id = mu_context_get_reg_pointer_value(&step[1], program->function_id_byte_len);
+		function_name->name = mub_copy_name(step + 1 + program->function_id_byte_len, program->bytecode + program->bytecode_len, &program->allocator);
+		if (function_name->name == MU_NULL_PTR) {
+			return MU_FAILURE;
+		}
+		scan->function_name_len++;
+	}
+
+	return MU_SUCCESS;
+}
+
+// builds the lookup tables of a program once every command has been scanned; on failure, the program still has to be
+// destroyed along with the scan's function names
+muResult mub_program_end(muProgram* program, mubProgramScan* scan) {
+	mu_memset(&program->instructions[program->instruction_len], 0, sizeof(mubInstruction));
+	program->instructions[program->instruction_len].handler = MUB_HANDLER_END_OF_CODE;
+	if (scan->lazy == MU_TRUE) {
+		program->lazy_ranges[program->lazy_range_len - 1].end = program->instruction_len;
+	}
+
+	uint64_m max_id = 0;
+	for (size_m i = 0; i < program->jump_marker_len; i++) {
+		if (program->jump_markers[i].index > max_id) {
+			max_id = program->jump_markers[i].index;
+		}
+	}
+	if (mub_id_table_create(&program->jump_marker_table, max_id, program->jump_marker_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->jump_marker_len; i++) {
+		mub_id_table_insert(&program->jump_marker_table, program->jump_markers[i].index, i);
+	}
+
+	max_id = 0;
+	for (size_m i = 0; i < program->function_len; i++) {
+		if (program->functions[i].index > max_id) {
+			max_id = program->functions[i].index;
+		}
+	}
+	if (mub_id_table_create(&program->function_table, max_id, program->function_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->function_len; i++) {
+		mub_id_table_insert(&program->function_table, program->functions[i].index, i);
+	}
+
+	max_id = 0;
+	for (size_m i = 0; i < program->external_function_len; i++) {
+		if (program->external_functions[i].index > max_id) {
+			max_id = program->external_functions[i].index;
+		}
+	}
+	if (mub_id_table_create(&program->external_function_table, max_id, program->external_function_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->external_function_len; i++) {
+		mub_id_table_insert(&program->external_function_table, program->external_functions[i].index, i);
+	}
+
+	// the first name given to a function is the one it keeps
+	for (size_m i = 0; i < scan->function_name_len; i++) {
+		size_m index = 0;
+		if (mub_id_table_find(&program->function_table, scan->function_names[i].id, &index) == MU_TRUE && program->functions[index].name == MU_NULL_PTR) {
+			program->functions[index].name = scan->function_names[i].name;
+			scan->function_names[i].name = MU_NULL_PTR;
+		}
+	}
+	mub_free_function_names(scan->function_names, scan->function_name_len, &program->allocator);
+	scan->function_names = MU_NULL_PTR;
+	scan->function_name_len = 0;
+
+	if (mub_name_table_create(&program->function_name_table, program->function_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->function_len; i++) {
+		mub_name_table_insert(&program->function_name_table, program->functions[i].name, i);
+	}
+	if (mub_name_table_create(&program->external_function_name_table, program->external_function_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->external_function_len; i++) {
+		mub_name_table_insert(&program->external_function_name_table, program->external_functions[i].name, i);
+	}
+	if (mub_name_table_create(&program->variable_name_table, program->variable_len, &program->allocator) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->variable_len; i++) {
+		mub_name_table_insert(&program->variable_name_table, program->variables[i].name, i);
+	}
+
+	if (scan->lazy == MU_FALSE) {
+		mub_resolve_instructions(program, 0, program->instruction_len);
+		for (size_m i = 0; i < program->function_len; i++) {
+			mub_verify_function(program, program->functions[i].instruction_index);
+		}
+	}
+
+	program->alive = MU_TRUE;
+	return MU_SUCCESS;
+}
+
+// borrowed bytecode is referenced instead of copied, and must outlive the program
+muProgram mub_program_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, muBool borrow_bytecode, muBool lazy, const muAllocator* allocator) {
+	muProgram program = {0};
+	program.alive = MU_FALSE;
+	program.allocator = mub_get_allocator(allocator);
+	
+	if (mu_bytecode_check_header_validity(bytecode, bytecode_len) != MU_SUCCESS) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+
+	if (borrow_bytecode == MU_TRUE) {
+		program.bytecode = bytecode;
+		program.owns_bytecode = MU_FALSE;
+	} else {
+		program.bytecode = mub_allocate(&program.allocator, bytecode_len * sizeof(muByte));
+		if (program.bytecode == MU_NULL_PTR) {
+			mu_print("[MUB] Failed to create program; malloc call failed.\n");
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return program;
+		}
+		mu_memcpy(program.bytecode, bytecode, bytecode_len * sizeof(muByte));
+		program.owns_bytecode = MU_TRUE;
+	}
+	program.bytecode_len = bytecode_len;
+
+	mubProgramScan scan;
+	if (mub_program_begin(&program, &scan, lazy) != MU_SUCCESS) {
+		mu_print("[MUB] Failed to create program; malloc call failed.\n");
+		program = mu_program_destroy(MU_NULL_PTR, program);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+	size_m code_end_index = program.bytecode_len - MU_END_HEADER_LENGTH;
+
+	// scan the bytecode once, collecting every table and decoding every command so that execution never has to look at the raw bytecode
+	muResult res = MU_SUCCESS;
+	muByte* step = program.bytecode;
+	while (step < program.bytecode + program.bytecode_len) {
+		muByte* next_step = mub_advance_header(&res, &program, step, program.bytecode, program.bytecode_len);
+		if (res == MU_FAILURE) {
+			if (fail_if_invalid_bytecode == MU_TRUE) {
+				mu_print("[MUB] Failed to create program; unrecognized command in bytecode.\n");
+				mub_free_function_names(scan.function_names, scan.function_name_len, &program.allocator);
+				program = mu_program_destroy(MU_NULL_PTR, program);
+				return program;
+			}
+		}
+
+		if (mub_program_scan_command(&program, &scan, step - program.bytecode, next_step - program.bytecode, code_end_index) != MU_SUCCESS) {
+			mu_print("[MUB] Failed to create program; realloc call failed.\n");
+			mub_free_function_names(scan.function_names, scan.function_name_len, &program.allocator);
+			program = mu_program_destroy(MU_NULL_PTR, program);
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return program;
+		}
+
+		step = next_step;
+	}
+	if (mub_program_end(&program, &scan) != MU_SUCCESS) {
+		mu_print("[MUB] Failed to create program; malloc call failed.\n");
+		mub_free_function_names(scan.function_names, scan.function_name_len, &program.allocator);
+		program = mu_program_destroy(MU_NULL_PTR, program);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return program;
+}
+
+MUDEF muProgram mu_program_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_FALSE, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_FALSE, allocator);
+}
+
+MUDEF muProgram mu_program_create_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_FALSE, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_FALSE, allocator);
+}
+
+MUDEF muProgram mu_program_create_lazy(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_TRUE, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_lazy_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_TRUE, allocator);
+}
+
+MUDEF muProgram mu_program_create_lazy_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_TRUE, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_lazy_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_program_create(result, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_TRUE, allocator);
+}
+
+// reads or maps a whole file; mapped is set to whether the bytecode needs to be unmapped rather than freed
+muByte* mub_load_file(const char* filename, size_m* bytecode_len, muBool* mapped, const muAllocator* allocator) {
+	*mapped = MU_FALSE;
+	*bytecode_len = 0;
+
+	#ifdef MUB_MMAP
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		return MU_NULL_PTR;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+		void* mapping = mmap(MU_NULL_PTR, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping != MAP_FAILED) {
+			close(fd);
+			*mapped = MU_TRUE;
+			*bytecode_len = (size_m)st.st_size;
+			return (muByte*)mapping;
+		}
+	}
+	close(fd);
+	#endif
+
+	// not mappable, so read it
+	FILE* file = fopen(filename, "rb");
+	if (file == MU_NULL_PTR) {
+		return MU_NULL_PTR;
+	}
+	size_m capacity = 0;
+	muByte* bytecode = MU_NULL_PTR;
+	while (MU_TRUE) {
+		if (mub_reserve((void**)&bytecode, &capacity, *bytecode_len + 4095, sizeof(muByte), allocator) != MU_SUCCESS) {
+			break;
+		}
+		size_m read_len = fread(bytecode + *bytecode_len, 1, capacity - *bytecode_len, file);
+		*bytecode_len += read_len;
+		if (read_len == 0) {
+			if (ferror(file) != 0) {
+				break;
+			}
+			fclose(file);
+			return bytecode;
+		}
+	}
+	fclose(file);
+	mub_deallocate(allocator, bytecode);
+	*bytecode_len = 0;
+	return MU_NULL_PTR;
+}
+
+void mub_unload_file(muByte* bytecode, size_m bytecode_len, muBool mapped, const muAllocator* allocator) {
+	if (mapped == MU_TRUE) {
+		#ifdef MUB_MMAP
+		munmap(bytecode, bytecode_len);
+		#endif
+		return;
+	}
+	#ifndef MUB_MMAP
+	(void)bytecode_len;
+	#endif
+	mub_deallocate(allocator, bytecode);
+}
+
+// the file's bytecode is borrowed by the program, which then takes over unloading it; bytecode that's read rather than
+// mapped is allocated with the program's allocator, so that the program can free it
+muProgram mub_program_create_from_file(muResult* result, const char* filename, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	muAllocator program_allocator = mub_get_allocator(allocator);
+	size_m bytecode_len = 0;
+	muBool mapped = MU_FALSE;
+	muByte* bytecode = mub_load_file(filename, &bytecode_len, &mapped, &program_allocator);
+	if (bytecode == MU_NULL_PTR) {
+		mu_print("[MUB] Failed to create program; file could not be read.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		muProgram program = {0};
+		program.alive = MU_FALSE;
+		return program;
+	}
+
+	muResult res = MU_SUCCESS;
+	muProgram program = mub_program_create(&res, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_FALSE, &program_allocator);
+	if (res != MU_SUCCESS || program.alive == MU_FALSE) {
+		mub_unload_file(bytecode, bytecode_len, mapped, &program_allocator);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+	program.owns_bytecode = (mapped == MU_TRUE) ? MU_FALSE : MU_TRUE;
+	program.mapped_bytecode = mapped;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return program;
+}
+
+MUDEF muProgram mu_program_create_from_file(muResult* result, const char* filename, muBool fail_if_invalid_bytecode) {
+	return mub_program_create_from_file(result, filename, fail_if_invalid_bytecode, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_from_file_with_allocator(muResult* result, const char* filename, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_program_create_from_file(result, filename, fail_if_invalid_bytecode, allocator);
+}
+
+// everything needed to execute the program is stored as-is, except for pointers, which are rebuilt when loading
+MUDEF size_m mu_program_write_image(muResult* result, muProgram* program, muByte* image, size_m image_len) {
+	if (program->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to write program image; given program is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+
+	// images are loaded as fully decoded programs, so a range that isn't decoded can't be written
+	for (size_m i = 0; i < program->lazy_range_len; i++) {
+		if (mub_prepare_range(program, i) != MU_SUCCESS) {
+			mu_print("[MUB] Failed to write program image; function could not be decoded.\n");
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return 0;
+		}
+	}
+
+	size_m offset = 0;
+	mubImageHeader header;
+	mub_image_get_header(&header);
+	mub_image_write(image, image_len, &offset, &header, sizeof(mubImageHeader));
+
+	mub_image_write_size(image, image_len, &offset, program->bytecode_len);
+	mub_image_write(image, image_len, &offset, program->bytecode, program->bytecode_len);
+
+	mub_image_write(image, image_len, &offset, &program->bytewidth, sizeof(muByte));
+	mub_image_write_size(image, image_len, &offset, program->function_id_byte_len);
+	mub_image_write_size(image, image_len, &offset, program->external_function_id_byte_len);
+	mub_image_write_size(image, image_len, &offset, program->jump_marker_id_byte_len);
+	mub_image_write_size(image, image_len, &offset, program->static_memory_len);
+	mub_image_write_size(image, image_len, &offset, program->temp_memory_len);
+	mub_image_write_size(image, image_len, &offset, program->reg0_spill_len);
+	mub_image_write_size(image, image_len, &offset, program->reg1_spill_len);
+
+	// including the record marking the end of the code
+	mub_image_write_size(image, image_len, &offset, program->instruction_len);
+	for (size_m i = 0; i <= program->instruction_len; i++) {
+		mubInstruction instruction;
+		mub_image_copy_instruction(&instruction, &program->instructions[i]);
+		if (instruction.handler == MUB_HANDLER_LAZY_ENTRY) {
+			instruction.handler = mub_get_instruction_handler(instruction.command);
+			instruction.target = 0;
+		}
+		mub_image_write(image, image_len, &offset, &instruction, sizeof(mubInstruction));
+	}
+
+	mub_image_write_size(image, image_len, &offset, program->function_len);
+	for (size_m i = 0; i < program->function_len; i++) {
+		muFunction function;
+		mu_memset(&function, 0, sizeof(muFunction));
+		function.bytecode_index = program->functions[i].bytecode_index;
+		function.instruction_index = program->functions[i].instruction_index;
+		function.index = program->functions[i].index;
+		mub_image_write(image, image_len, &offset, &function, sizeof(muFunction));
+		mub_image_write_name(image, image_len, &offset, program->functions[i].name);
+	}
+
+	mub_image_write_size(image, image_len, &offset, program->external_function_len);
+	for (size_m i = 0; i < program->external_function_len; i++) {
+		muExternalFunction external_function;
+		mu_memset(&external_function, 0, sizeof(muExternalFunction));
+		external_function.index = program->external_functions[i].index;
+		mub_image_write(image, image_len, &offset, &external_function, sizeof(muExternalFunction));
+		mub_image_write_name(image, image_len, &offset, program->external_functions[i].name);
+	}
+
+	mub_image_write_size(image, image_len, &offset, program->jump_marker_len);
+	mub_image_write(image, image_len, &offset, program->jump_markers, sizeof(muJumpMarker) * program->jump_marker_len);
+
+	mub_image_write_size(image, image_len, &offset, program->variable_len);
+	for (size_m i = 0; i < program->variable_len; i++) {
+		muVariable variable;
+		mu_memset(&variable, 0, sizeof(muVariable));
+		variable.address = program->variables[i].address;
+		mub_image_copy_data_type(&variable.datatype, program->variables[i].datatype);
+		mub_image_write(image, image_len, &offset, &variable, sizeof(muVariable));
+		mub_image_write_name(image, image_len, &offset, program->variables[i].name);
+	}
+
+	mub_image_write_id_table(image, image_len, &offset, &program->function_table);
+	mub_image_write_id_table(image, image_len, &offset, &program->external_function_table);
+	mub_image_write_id_table(image, image_len, &offset, &program->jump_marker_table);
+
+	mub_image_write_name_table(image, image_len, &offset, &program->function_name_table);
+	mub_image_write_name_table(image, image_len, &offset, &program->external_function_name_table);
+	mub_image_write_name_table(image, image_len, &offset, &program->variable_name_table);
+
+	// a null image only asks for the length
+	if (image != MU_NULL_PTR && offset > image_len) {
+		mu_print("[MUB] Failed to write program image; given image is too small.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return offset;
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return offset;
+}
+
+muResult mub_read_image(muProgram* program, muByte* image, size_m image_len) {
+	size_m offset = 0;
+	mubImageHeader header;
+	mubImageHeader expected_header;
+	mub_image_get_header(&expected_header);
+	if (mub_image_read(image, image_len, &offset, &header, sizeof(mubImageHeader)) != MU_SUCCESS) {
+		return MU_FAILURE;
+	}
+	if (header.signature[0] != 'm' || header.signature[1] != 'u' || header.signature[2] != 'b' || header.signature[3] != 'i') {
+		mu_print("[MUB] Failed to create program; invalid image signature.\n");
+		return MU_FAILURE;
+	}
+	if (header.version != expected_header.version) {
+		mu_print("[MUB] Failed to create program; unsupported image version.\n");
+		return MU_FAILURE;
+	}
+	if (header.byte_order != expected_header.byte_order ||
+		header.size_m_size != expected_header.size_m_size ||
+		header.instruction_size != expected_header.instruction_size ||
+		header.function_size != expected_header.function_size ||
+		header.external_function_size != expected_header.external_function_size ||
+		header.jump_marker_size != expected_header.jump_marker_size ||
+		header.variable_size != expected_header.variable_size
+	) {
+		mu_print("[MUB] Failed to create program; image was written by an incompatible build.\n");
+		return MU_FAILURE;
+	}
+
+	if (mub_image_read_size(image, image_len, &offset, &program->bytecode_len) != MU_SUCCESS ||
+		mub_image_read_array(image, image_len, &offset, (void**)&program->bytecode, program->bytecode_len, sizeof(muByte), &program->allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+	program->owns_bytecode = MU_TRUE;
+
+	if (mub_image_read(image, image_len, &offset, &program->bytewidth, sizeof(muByte)) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->function_id_byte_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->external_function_id_byte_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->jump_marker_id_byte_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->static_memory_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->temp_memory_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->reg0_spill_len) != MU_SUCCESS ||
+		mub_image_read_size(image, image_len, &offset, &program->reg1_spill_len) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+
+	if (mub_image_read_size(image, image_len, &offset, &program->instruction_len) != MU_SUCCESS ||
+		program->instruction_len == (size_m)-1 ||
+		mub_image_read_array(image, image_len, &offset, (void**)&program->instructions, program->instruction_len + 1, sizeof(mubInstruction), &program->allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+	// every index the engine follows has to stay within the instructions
+	for (size_m i = 0; i <= program->instruction_len; i++) {
+		mubInstruction* instruction = &program->instructions[i];
+		if (instruction->handler >= MUB_HANDLER_COUNT || instruction->handler == MUB_HANDLER_LAZY_ENTRY ||
+			instruction->next > program->instruction_len ||
+			instruction->skip > program->instruction_len ||
+			instruction->target > program->instruction_len ||
+			instruction->src0.bytecode_index > program->bytecode_len ||
+			instruction->src1.bytecode_index > program->bytecode_len ||
+			instruction->dst.bytecode_index > program->bytecode_len ||
+			(instruction->src0.datatype.pointer_count == 0 && instruction->src0.datatype.byte_size > program->bytecode_len - instruction->src0.bytecode_index) ||
+			(instruction->src1.datatype.pointer_count == 0 && instruction->src1.datatype.byte_size > program->bytecode_len - instruction->src1.bytecode_index)
+		) {
+			return MU_FAILURE;
+		}
+		instruction->kernel = mub_get_instruction_kernel(instruction);
+		// instructions that skip their checks would trust whatever the image says
+		if ((instruction->handler == MUB_HANDLER_VERIFIED_OPERATION || instruction->handler == MUB_HANDLER_VERIFIED_IF) &&
+			(mub_can_skip_checks(program, instruction) == MU_FALSE || (instruction->handler == MUB_HANDLER_VERIFIED_IF) != (instruction->command == 0xA0))
+		) {
+			return MU_FAILURE;
+		}
+	}
+	if (program->instructions[program->instruction_len].handler != MUB_HANDLER_END_OF_CODE) {
+		return MU_FAILURE;
+	}
+
+	// names follow each record, so the records are read one by one
+	if (mub_image_read_size(image, image_len, &offset, &program->function_len) != MU_SUCCESS ||
+		mub_image_allocate_array(image_len, offset, (void**)&program->functions, program->function_len, sizeof(muFunction), &program->allocator) != MU_SUCCESS
+	) {
+		program->function_len = 0;
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->function_len; i++) {
+		if (mub_image_read(image, image_len, &offset, &program->functions[i], sizeof(muFunction)) != MU_SUCCESS) {
+			program->functions[i].name = MU_NULL_PTR;
+			return MU_FAILURE;
+		}
+		if (mub_image_read_name(image, image_len, &offset, &program->functions[i].name, &program->allocator) != MU_SUCCESS ||
+			program->functions[i].instruction_index > program->instruction_len
+		) {
+			return MU_FAILURE;
+		}
+	}
+
+	if (mub_image_read_size(image, image_len, &offset, &program->external_function_len) != MU_SUCCESS ||
+		mub_image_allocate_array(image_len, offset, (void**)&program->external_functions, program->external_function_len, sizeof(muExternalFunction), &program->allocator) != MU_SUCCESS
+	) {
+		program->external_function_len = 0;
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->external_function_len; i++) {
+		if (mub_image_read(image, image_len, &offset, &program->external_functions[i], sizeof(muExternalFunction)) != MU_SUCCESS) {
+			program->external_functions[i].name = MU_NULL_PTR;
+			return MU_FAILURE;
+		}
+		if (mub_image_read_name(image, image_len, &offset, &program->external_functions[i].name, &program->allocator) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+	}
+
+	if (mub_image_read_size(image, image_len, &offset, &program->jump_marker_len) != MU_SUCCESS ||
+		mub_image_read_array(image, image_len, &offset, (void**)&program->jump_markers, program->jump_marker_len, sizeof(muJumpMarker), &program->allocator) != MU_SUCCESS
+	) {
+		program->jump_marker_len = 0;
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->jump_marker_len; i++) {
+		if (program->jump_markers[i].instruction_index > program->instruction_len) {
+			return MU_FAILURE;
+		}
+	}
+
+	if (mub_image_read_size(image, image_len, &offset, &program->variable_len) != MU_SUCCESS ||
+		mub_image_allocate_array(image_len, offset, (void**)&program->variables, program->variable_len, sizeof(muVariable), &program->allocator) != MU_SUCCESS
+	) {
+		program->variable_len = 0;
+		return MU_FAILURE;
+	}
+	for (size_m i = 0; i < program->variable_len; i++) {
+		if (mub_image_read(image, image_len, &offset, &program->variables[i], sizeof(muVariable)) != MU_SUCCESS) {
+			program->variables[i].name = MU_NULL_PTR;
+			return MU_FAILURE;
+		}
+		if (mub_image_read_name(image, image_len, &offset, &program->variables[i].name, &program->allocator) != MU_SUCCESS) {
+			return MU_FAILURE;
+		}
+	}
+
+	if (mub_image_read_id_table(image, image_len, &offset, &program->function_table, program->function_len, &program->allocator) != MU_SUCCESS ||
+		mub_image_read_id_table(image, image_len, &offset, &program->external_function_table, program->external_function_len, &program->allocator) != MU_SUCCESS ||
+		mub_image_read_id_table(image, image_len, &offset, &program->jump_marker_table, program->jump_marker_len, &program->allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+
+	if (mub_image_read_name_table(image, image_len, &offset, &program->function_name_table, program->functions, sizeof(muFunction), offsetof(muFunction, name), program->function_len, &program->allocator) != MU_SUCCESS ||
+		mub_image_read_name_table(image, image_len, &offset, &program->external_function_name_table, program->external_functions, sizeof(muExternalFunction), offsetof(muExternalFunction, name), program->external_function_len, &program->allocator) != MU_SUCCESS ||
+		mub_image_read_name_table(image, image_len, &offset, &program->variable_name_table, program->variables, sizeof(muVariable), offsetof(muVariable, name), program->variable_len, &program->allocator) != MU_SUCCESS
+	) {
+		return MU_FAILURE;
+	}
+
+	return MU_SUCCESS;
+}
+
+// the image is copied, so it can be freed once the program is created
+muProgram mub_program_create_from_image(muResult* result, muByte* image, size_m image_len, const muAllocator* allocator) {
+	muProgram program = {0};
+	program.alive = MU_FALSE;
+	program.allocator = mub_get_allocator(allocator);
+
+	if (mub_read_image(&program, image, image_len) != MU_SUCCESS) {
+		mu_print("[MUB] Failed to create program; invalid image.\n");
+		program = mu_program_destroy(MU_NULL_PTR, program);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+
+	program.alive = MU_TRUE;
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return program;
+}
+
+MUDEF muProgram mu_program_create_from_image(muResult* result, muByte* image, size_m image_len) {
+	return mub_program_create_from_image(result, image, image_len, MU_NULL_PTR);
+}
+
+MUDEF muProgram mu_program_create_from_image_with_allocator(muResult* result, muByte* image, size_m image_len, const muAllocator* allocator) {
+	return mub_program_create_from_image(result, image, image_len, allocator);
+}
+
+// the loader's bytecode and the program it becomes are allocated with the given allocator
+muLoader mub_loader_create(muResult* result, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	muLoader loader = {0};
+	loader.alive = MU_TRUE;
+	loader.fail_if_invalid_bytecode = fail_if_invalid_bytecode;
+	loader.begun = MU_FALSE;
+	loader.finished = MU_FALSE;
+	loader.bytecode_capacity = 0;
+	loader.scan_index = 0;
+
+	// the bytecode is handed over along with the program once the loader is finished
+	loader.program.alive = MU_FALSE;
+	loader.program.allocator = mub_get_allocator(allocator);
+	loader.program.bytecode = MU_NULL_PTR;
+	loader.program.bytecode_len = 0;
+	loader.program.owns_bytecode = MU_TRUE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return loader;
+}
+
+MUDEF muLoader mu_loader_create(muResult* result, muBool fail_if_invalid_bytecode) {
+	return mub_loader_create(result, fail_if_invalid_bytecode, MU_NULL_PTR);
+}
+
+MUDEF muLoader mu_loader_create_with_allocator(muResult* result, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_loader_create(result, fail_if_invalid_bytecode, allocator);
+}
+
+MUDEF muLoader mu_loader_destroy(muResult* result, muLoader loader) {
+	mub_free_function_names(loader.scan.function_names, loader.scan.function_name_len, &loader.program.allocator);
+	loader.scan.function_names = MU_NULL_PTR;
+	loader.scan.function_name_len = 0;
+
+	loader.program = mu_program_destroy(MU_NULL_PTR, loader.program);
+	loader.bytecode_capacity = 0;
+	loader.alive = MU_FALSE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return loader;
+}
+
+// checks for the end header at the given place rather than at the end of the bytecode
+muBool mub_is_end_header(muByte* bytecode) {
+	return (
+		bytecode[0] == mu_binary(01100101) &&
+		bytecode[1] == mu_binary(01101110) &&
+		bytecode[2] == mu_binary(01100100) &&
+		bytecode[3] == mu_binary(11111111)
+	) ? MU_TRUE : MU_FALSE;
+}
+
+// commands are scanned as soon as the whole command has arrived, so only the last partial command waits for the next chunk
+MUDEF muBool mu_loader_feed(muResult* result, muLoader* loader, muByte* chunk, size_m chunk_len) {
+	if (loader->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to feed loader; given loader is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return MU_FALSE;
+	}
+	if (chunk_len == 0) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_SUCCESS;
+		}
+		return loader->finished;
+	}
+	if (loader->finished == MU_TRUE) {
+		mu_print("[MUB] Failed to feed loader; bytecode continues past the end header.\n");
+		*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return MU_FALSE;
+	}
+
+	muProgram* program = &loader->program;
+	if (mub_reserve((void**)&program->bytecode, &loader->bytecode_capacity, program->bytecode_len + chunk_len, sizeof(muByte), &program->allocator) != MU_SUCCESS) {
+		mu_print("[MUB] Failed to feed loader; realloc call failed.\n");
+		*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return MU_FALSE;
+	}
+	mu_memcpy(program->bytecode + program->bytecode_len, chunk, chunk_len);
+	program->bytecode_len += chunk_len;
+
+	if (loader->begun == MU_FALSE) {
+		if (program->bytecode_len < MU_BEGINNING_HEADER_LENGTH) {
+			if (result != MU_NULL_PTR) {
+				*result = MU_SUCCESS;
+			}
+			return MU_FALSE;
+		}
+		if (mub_check_beginning_header(program->bytecode) != MU_SUCCESS) {
+			*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return MU_FALSE;
+		}
+		if (mub_program_begin(program, &loader->scan, MU_FALSE) != MU_SUCCESS ||
+			mub_program_scan_command(program, &loader->scan, 0, MU_BEGINNING_HEADER_LENGTH, program->bytecode_len) != MU_SUCCESS
+		) {
+			mu_print("[MUB] Failed to feed loader; realloc call failed.\n");
+			*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return MU_FALSE;
+		}
+		loader->scan_index = MU_BEGINNING_HEADER_LENGTH;
+		loader->begun = MU_TRUE;
+	}
+
+	// the first 4 bytes of a command are enough to know its length (or, for names, where to look for its null terminator),
+	// and the end header is 4 bytes long
+	muResult res = MU_SUCCESS;
+	while (program->bytecode_len - loader->scan_index >= 4) {
+		size_m step_index = loader->scan_index;
+		size_m next_step_index = 0;
+		muBool end_header = mub_is_end_header(program->bytecode + step_index);
+		if (end_header == MU_TRUE) {
+			next_step_index = step_index + MU_END_HEADER_LENGTH;
+		} else {
+			next_step_index = mub_advance_header(&res, program, program->bytecode + step_index, program->bytecode, program->bytecode_len) - program->bytecode;
+			if (next_step_index > program->bytecode_len) {
+				break;
+			}
+			if (res == MU_FAILURE && loader->fail_if_invalid_bytecode == MU_TRUE) {
+				mu_print("[MUB] Failed to feed loader; unrecognized command in bytecode.\n");
+				*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+				if (result != MU_NULL_PTR) {
+					*result = MU_FAILURE;
+				}
+				return MU_FALSE;
+			}
+		}
+
+		if (mub_program_scan_command(program, &loader->scan, step_index, next_step_index, (end_header == MU_TRUE) ? step_index : program->bytecode_len) != MU_SUCCESS) {
+			mu_print("[MUB] Failed to feed loader; realloc call failed.\n");
+			*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
+			}
+			return MU_FALSE;
+		}
+		loader->scan_index = next_step_index;
+
+		if (end_header == MU_TRUE) {
+			loader->finished = MU_TRUE;
+			if (loader->scan_index != program->bytecode_len) {
+				mu_print("[MUB] Failed to feed loader; bytecode continues past the end header.\n");
+				*loader = mu_loader_destroy(MU_NULL_PTR, *loader);
+				if (result != MU_NULL_PTR) {
+					*result = MU_FAILURE;
+				}
+				return MU_FALSE;
+			}
+			break;
+		}
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return loader->finished;
+}
+
+// the program takes over the loader's bytecode and everything scanned so far, leaving the loader empty
+MUDEF muProgram mu_program_create_from_loader(muResult* result, muLoader* loader) {
+	muProgram program = {0};
+	program.alive = MU_FALSE;
+
+	if (loader->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to create program; given loader is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+	if (loader->finished == MU_FALSE) {
+		mu_print("[MUB] Failed to create program; the loader hasn't reached the end header.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+
+	program = loader->program;
+	muAllocator allocator = program.allocator;
+	muResult res = mub_program_end(&program, &loader->scan);
+	if (res != MU_SUCCESS) {
+		mu_print("[MUB] Failed to create program; malloc call failed.\n");
+		mub_free_function_names(loader->scan.function_names, loader->scan.function_name_len, &program.allocator);
+		program = mu_program_destroy(MU_NULL_PTR, program);
+	}
+	*loader = mub_loader_create(MU_NULL_PTR, loader->fail_if_invalid_bytecode, &allocator);
+	if (res != MU_SUCCESS) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return program;
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return program;
+}
+
+MUDEF muProgram mu_program_destroy(muResult* result, muProgram program) {
+	if (program.bytecode != MU_NULL_PTR) {
+		if (program.mapped_bytecode == MU_TRUE) {
+			mub_unload_file(program.bytecode, program.bytecode_len, MU_TRUE, &program.allocator);
+		} else if (program.owns_bytecode == MU_TRUE) {
+			mub_deallocate(&program.allocator, program.bytecode);
+		}
+		program.bytecode = MU_NULL_PTR;
+		program.mapped_bytecode = MU_FALSE;
+	}
+
+	if (program.instructions != MU_NULL_PTR) {
+		mub_deallocate(&program.allocator, program.instructions);
+		program.instructions = MU_NULL_PTR;
+		program.instruction_len = 0;
+	}
+
+	mub_id_table_destroy(&program.jump_marker_table, &program.allocator);
+	mub_id_table_destroy(&program.function_table, &program.allocator);
+	mub_id_table_destroy(&program.external_function_table, &program.allocator);
+
+	mub_name_table_destroy(&program.function_name_table, &program.allocator);
+	mub_name_table_destroy(&program.external_function_name_table, &program.allocator);
+	mub_name_table_destroy(&program.variable_name_table, &program.allocator);
+
+	if (program.lazy_ranges != MU_NULL_PTR) {
+		mub_deallocate(&program.allocator, program.lazy_ranges);
+		program.lazy_ranges = MU_NULL_PTR;
+		program.lazy_range_len = 0;
+	}
+
+	if (program.jump_markers != MU_NULL_PTR) {
+		mub_deallocate(&program.allocator, program.jump_markers);
+		program.jump_markers = MU_NULL_PTR;
+		program.jump_marker_len = 0;
+	}
+
+	if (program.functions != MU_NULL_PTR) {
+		for (size_m i = 0; i < program.function_len; i++) {
+			if (program.functions[i].name != MU_NULL_PTR) {
+				mub_deallocate(&program.allocator, program.functions[i].name);
+				program.functions[i].name = MU_NULL_PTR;
+			}
+		}
+		mub_deallocate(&program.allocator, program.functions);
+		program.functions = MU_NULL_PTR;
+		program.function_len = 0;
+	}
+
+	if (program.external_functions != MU_NULL_PTR) {
+		for (size_m i = 0; i < program.external_function_len; i++) {
+			if (program.external_functions[i].name != MU_NULL_PTR) {
+				mub_deallocate(&program.allocator, program.external_functions[i].name);
+				program.external_functions[i].name = MU_NULL_PTR;
+			}
+		}
+		mub_deallocate(&program.allocator, program.external_functions);
+		program.external_functions = MU_NULL_PTR;
+		program.external_function_len = 0;
+	}
+
+	if (program.variables != MU_NULL_PTR) {
+		for (size_m i = 0; i < program.variable_len; i++) {
+			if (program.variables[i].name != MU_NULL_PTR) {
+				mub_deallocate(&program.allocator, program.variables[i].name);
+				program.variables[i].name = MU_NULL_PTR;
+			}
+		}
+		mub_deallocate(&program.allocator, program.variables);
+		program.variables = MU_NULL_PTR;
+		program.variable_len = 0;
+	}
+
+	program.alive = MU_FALSE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+
+	return program;
+}
+
+muContext mub_context_create_from_program(muResult* result, muProgram* program, const muAllocator* allocator) {
+	muContext context = {0};
+	context.alive = MU_FALSE;
+	context.allocator = mub_get_allocator(allocator);
+
+	if (program == MU_NULL_PTR || program->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to create context; given program is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+
+	context.program = program;
+	context.owns_program = MU_FALSE;
+	context.main_return = 0;
+	context.last_if = MU_FALSE;
+
+	context.static_memory_len = program->static_memory_len;
+	context.temp_memory_len = program->temp_memory_len;
+	context.dynamic_memory_len = 0;
+	context.dynamic_memory_capacity = 0;
+	context.dynamic_memory = MU_NULL_PTR;
+
+	#ifdef MUB_FLAT_MEMORY
+	if (context.temp_memory_len > ((size_m)-1) - context.static_memory_len) {
+		mu_print("[MUB] Failed to create context; memory is too big.\n");
+		context = mu_context_destroy(MU_NULL_PTR, context);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+	muBool reserved = MU_FALSE;
+	#ifdef MUB_GUARD_PAGE_MEMORY
+	reserved = mub_reserve_guarded_memory(&context);
+	#endif
+	if (reserved == MU_FALSE) {
+		context.static_memory_offset = context.temp_memory_len;
+		context.memory = mub_allocate_zeroed_memory(&context.allocator, context.temp_memory_len + context.static_memory_len, &context.memory_mapped);
+	}
+	mub_set_memory_sections(&context);
+	if (context.temp_memory_len + context.static_memory_len > 0 && context.memory == MU_NULL_PTR) {
+	#else
+	context.static_memory = mub_allocate_zeroed_memory(&context.allocator, context.static_memory_len, &context.static_memory_mapped);
+	context.temp_memory = mub_allocate_zeroed_memory(&context.allocator, context.temp_memory_len, &context.temp_memory_mapped);
+	if ((context.static_memory_len > 0 && context.static_memory == MU_NULL_PTR) || (context.temp_memory_len > 0 && context.temp_memory == MU_NULL_PTR)) {
+	#endif
+		mu_print("[MUB] Failed to create context; malloc call failed.\n");
+		context = mu_context_destroy(MU_NULL_PTR, context);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+
+	context.external_functions = MU_NULL_PTR;
+	if (program->external_function_len > 0) {
+		context.external_functions = mub_allocate(&context.allocator, sizeof(void(*)(void*)) * program->external_function_len);
+		if (context.external_functions != MU_NULL_PTR) {
+			for (size_m i = 0; i < program->external_function_len; i++) {
+				context.external_functions[i] = MU_NULL_PTR;
+			}
+		}
+	}
+
+	context.reg0.spill_len = program->reg0_spill_len;
+	context.reg0.spill = MU_NULL_PTR;
+	if (context.reg0.spill_len > 0) {
+		context.reg0.spill = mub_allocate(&context.allocator, context.reg0.spill_len);
+	}
+	context.reg1.spill_len = program->reg1_spill_len;
+	context.reg1.spill = MU_NULL_PTR;
+	if (context.reg1.spill_len > 0) {
+		context.reg1.spill = mub_allocate(&context.allocator, context.reg1.spill_len);
+	}
+
+	if ((program->external_function_len > 0 && context.external_functions == MU_NULL_PTR) ||
+		(context.reg0.spill_len > 0 && context.reg0.spill == MU_NULL_PTR) ||
+		(context.reg1.spill_len > 0 && context.reg1.spill == MU_NULL_PTR)
+	) {
+		mu_print("[MUB] Failed to create context; malloc call failed.\n");
+		context = mu_context_destroy(MU_NULL_PTR, context);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+
+	context.frames = MU_NULL_PTR;
+	context.frame_len = 0;
+	context.frame_capacity = 0;
+
+	context.alive = MU_TRUE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return context;
+}
+
+MUDEF muContext mu_context_create_from_program(muResult* result, muProgram* program) {
+	return mub_context_create_from_program(result, program, MU_NULL_PTR);
+}
+
+MUDEF muContext mu_context_create_from_program_with_allocator(muResult* result, muProgram* program, const muAllocator* allocator) {
+	return mub_context_create_from_program(result, program, allocator);
+}
+
+// creates a context owning the given program, destroying the program if that fails;
+// the context is allocated with the program's allocator
+muContext mub_context_create_owning_program(muResult* result, muProgram created_program) {
+	muContext context = {0};
+	context.alive = MU_FALSE;
+
+	if (created_program.alive == MU_FALSE) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+
+	muProgram* program = mub_allocate(&created_program.allocator, sizeof(muProgram));
+	if (program == MU_NULL_PTR) {
+		mu_print("[MUB] Failed to create context; malloc call failed.\n");
+		created_program = mu_program_destroy(MU_NULL_PTR, created_program);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+	*program = created_program;
+
+	muResult res = MU_SUCCESS;
+	context = mub_context_create_from_program(&res, program, &program->allocator);
+	if (res != MU_SUCCESS) {
+		*program = mu_program_destroy(MU_NULL_PTR, *program);
+		mub_deallocate(&created_program.allocator, program);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return context;
+	}
+	context.owns_program = MU_TRUE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return context;
+}
+
+MUDEF muContext mu_context_create(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_context_create_owning_program(result, mub_program_create(MU_NULL_PTR, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_FALSE, MU_NULL_PTR));
+}
+
+MUDEF muContext mu_context_create_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_context_create_owning_program(result, mub_program_create(MU_NULL_PTR, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_FALSE, MU_FALSE, allocator));
+}
+
+MUDEF muContext mu_context_create_borrowed(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode) {
+	return mub_context_create_owning_program(result, mub_program_create(MU_NULL_PTR, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_FALSE, MU_NULL_PTR));
+}
+
+MUDEF muContext mu_context_create_borrowed_with_allocator(muResult* result, muByte* bytecode, size_m bytecode_len, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_context_create_owning_program(result, mub_program_create(MU_NULL_PTR, bytecode, bytecode_len, fail_if_invalid_bytecode, MU_TRUE, MU_FALSE, allocator));
+}
+
+MUDEF muContext mu_context_create_from_file(muResult* result, const char* filename, muBool fail_if_invalid_bytecode) {
+	return mub_context_create_owning_program(result, mub_program_create_from_file(MU_NULL_PTR, filename, fail_if_invalid_bytecode, MU_NULL_PTR));
+}
+
+MUDEF muContext mu_context_create_from_file_with_allocator(muResult* result, const char* filename, muBool fail_if_invalid_bytecode, const muAllocator* allocator) {
+	return mub_context_create_owning_program(result, mub_program_create_from_file(MU_NULL_PTR, filename, fail_if_invalid_bytecode, allocator));
+}
+
+MUDEF muContext mu_context_create_from_image(muResult* result, muByte* image, size_m image_len) {
+	return mub_context_create_owning_program(result, mub_program_create_from_image(MU_NULL_PTR, image, image_len, MU_NULL_PTR));
+}
+
+MUDEF muContext mu_context_create_from_image_with_allocator(muResult* result, muByte* image, size_m image_len, const muAllocator* allocator) {
+	return mub_context_create_owning_program(result, mub_program_create_from_image(MU_NULL_PTR, image, image_len, allocator));
+}
+
+MUDEF muContext mu_context_create_from_loader(muResult* result, muLoader* loader) {
+	return mub_context_create_owning_program(result, mu_program_create_from_loader(MU_NULL_PTR, loader));
+}
+
+MUDEF muContext mu_context_destroy(muResult* result, muContext context) {
+	if (context.external_functions != MU_NULL_PTR) {
+		mub_deallocate(&context.allocator, context.external_functions);
+		context.external_functions = MU_NULL_PTR;
+	}
+
+	#ifdef MUB_FLAT_MEMORY
+	if (context.memory != MU_NULL_PTR) {
+		mub_free_flat_memory(&context);
+	}
+	mub_set_memory_sections(&context);
+	context.static_memory_len = 0;
+	context.temp_memory_len = 0;
+	context.dynamic_memory_len = 0;
+	context.dynamic_memory_capacity = 0;
+	#else
+	if (context.static_memory != MU_NULL_PTR) {
+		mub_free_zeroed_memory(&context.allocator, context.static_memory, context.static_memory_len, context.static_memory_mapped);
+		context.static_memory = MU_NULL_PTR;
+		context.static_memory_len = 0;
+		context.static_memory_mapped = MU_FALSE;
+	}
+
+	if (context.temp_memory != MU_NULL_PTR) {
+		mub_free_zeroed_memory(&context.allocator, context.temp_memory, context.temp_memory_len, context.temp_memory_mapped);
+		context.temp_memory = MU_NULL_PTR;
+		context.temp_memory_len = 0;
+		context.temp_memory_mapped = MU_FALSE;
+	}
+
+	if (context.dynamic_memory != MU_NULL_PTR) {
+		mub_deallocate(&context.allocator, context.dynamic_memory);
+		context.dynamic_memory = MU_NULL_PTR;
+		context.dynamic_memory_len = 0;
+		context.dynamic_memory_capacity = 0;
+	}
+	#endif
+
+	if (context.reg0.spill != MU_NULL_PTR) {
+		mub_deallocate(&context.allocator, context.reg0.spill);
+		context.reg0.spill = MU_NULL_PTR;
+		context.reg0.spill_len = 0;
+	}
+
+	if (context.reg1.spill != MU_NULL_PTR) {
+		mub_deallocate(&context.allocator, context.reg1.spill);
+		context.reg1.spill = MU_NULL_PTR;
+		context.reg1.spill_len = 0;
+	}
+
+	if (context.frames != MU_NULL_PTR) {
+		mub_deallocate(&context.allocator, context.frames);
+		context.frames = MU_NULL_PTR;
+		context.frame_len = 0;
+		context.frame_capacity = 0;
+	}
+
+	if (context.program != MU_NULL_PTR && context.owns_program == MU_TRUE) {
+		// the program's allocator is copied out, as it's gone once the program is destroyed
+		muAllocator program_allocator = context.program->allocator;
+		*context.program = mu_program_destroy(MU_NULL_PTR, *context.program);
+		mub_deallocate(&program_allocator, context.program);
+	}
+	context.program = MU_NULL_PTR;
+	context.owns_program = MU_FALSE;
+
+	context.alive = MU_FALSE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+
+	return context;
+}
+
+// puts the context back in the state it was created in, keeping every allocation and external function;
+// dynamic memory keeps its capacity for the next time the dynamic buffer is resized
+MUDEF void mu_context_reset(muResult* result, muContext* context) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to reset context; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+
+	context->main_return = 0;
+	context->last_if = MU_FALSE;
+
+	#ifdef MUB_FLAT_MEMORY
+	if (context->memory != MU_NULL_PTR && context->memory_reserved > 0) {
+		// guarded memory keeps temporary and static memory apart, in pages that are always mapped
+		mub_clear_zeroed_memory(context->memory, context->temp_memory_len, MU_TRUE);
+		mub_clear_zeroed_memory(context->memory + context->static_memory_offset, context->static_memory_len, MU_TRUE);
+	} else if (context->memory != MU_NULL_PTR) {
+		mub_clear_zeroed_memory(context->memory, context->temp_memory_len + context->static_memory_len, context->memory_mapped);
+	}
+	#else
+	if (context->static_memory != MU_NULL_PTR) {
+		mub_clear_zeroed_memory(context->static_memory, context->static_memory_len, context->static_memory_mapped);
+	}
+	if (context->temp_memory != MU_NULL_PTR) {
+		mub_clear_zeroed_memory(context->temp_memory, context->temp_memory_len, context->temp_memory_mapped);
+	}
+	#endif
+	context->dynamic_memory_len = 0;
+	#ifdef MUB_FLAT_MEMORY
+	mub_set_memory_sections(context);
+	#endif
+
+	mu_memset(&context->reg0.value, 0, sizeof(context->reg0.value));
+	mu_memset(&context->reg1.value, 0, sizeof(context->reg1.value));
+
+	context->frame_len = 0;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+}
+
+MUDEF int mu_context_execute_main(muResult* result, muContext* context) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to execute main; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+	size_m main_function_id = 0;
+	if (mub_id_table_find(&context->program->function_table, 0, &main_function_id) == MU_FALSE) {
+		mu_print("[MUB] Failed to execute main; no main function specified in the bytecode.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+
+	int32_m main_return = 0;
+	if (mub_execute_function(context, context->program->functions[main_function_id].instruction_index, &main_return) != MU_SUCCESS) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+
+	return main_return;
+}
+
+MUDEF void mu_context_execute_function(muResult* result, muContext* context, size_m id) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to execute function; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	if (id == 0) {
+		mu_print("[MUB] Failed to execute function; ID #0 (aka main) cannot be executed via the \"execute function\" function, the \"execute main\" function needs to be used.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	size_m actual_index = 0;
+	if (mub_id_table_find(&context->program->function_table, id, &actual_index) == MU_FALSE) {
+		mu_print("[MUB] Failed to execute function; no function has the given ID.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	if (result != MU_NULL_PTR) {
+		*result = mub_execute_function(context, context->program->functions[actual_index].instruction_index, MU_NULL_PTR);
+	} else {
+		mub_execute_function(context, context->program->functions[actual_index].instruction_index, MU_NULL_PTR);
+	}
+}
+
+MUDEF size_m mu_context_get_function_id(muResult* result, muContext* context, const char* name) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to get function id; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+	size_m index = 0;
+	if (mub_name_table_find(&context->program->function_name_table, name, &index) == MU_TRUE) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_SUCCESS;
+		}
+		return context->program->functions[index].index;
+	}
+	mu_print("[MUB] Failed to get function id; no function name matches.\n");
+	if (result != MU_NULL_PTR) {
+		*result = MU_FAILURE;
+	}
+	return 0;
+}
+
+MUDEF muVariable mu_context_get_variable(muResult* result, muContext* context, const char* name) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to get variable; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		muVariable variable = {0};
+		return variable;
+	}
+	size_m index = 0;
+	if (mub_name_table_find(&context->program->variable_name_table, name, &index) == MU_TRUE) {
+		if (result != MU_NULL_PTR) {
+			*result = MU_SUCCESS;
+		}
+		return context->program->variables[index];
+	}
+	mu_print("[MUB] Failed to get variable; no variable with the given name could found.\n");
+	if (result != MU_NULL_PTR) {
+		*result = MU_FAILURE;
+	}
+	muVariable variable = {0};
+	return variable;
+}
+
+MUDEF void mu_context_get_variable_data(muResult* result, muContext* context, muVariable variable, void* data) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to get variable data; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	muByte* location = mu_context_get_memory_location(context, variable.address, variable.datatype.temp);
+	if (location == MU_NULL_PTR || 
+		mu_context_get_memory_location(context, variable.address + variable.datatype.byte_size - 1, variable.datatype.temp) == MU_NULL_PTR
+	) {
+		mu_print("[MUB] Failed to get variable data; memory address location is out of range.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	mu_memcpy(data, location, variable.datatype.byte_size);
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+}
+
+MUDEF void mu_context_set_variable_data(muResult* result, muContext* context, muVariable variable, void* data) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to set variable data; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	muByte* location = mu_context_get_memory_location(context, variable.address, variable.datatype.temp);
+	if (location == MU_NULL_PTR || 
+		mu_context_get_memory_location(context, variable.address + variable.datatype.byte_size - 1, variable.datatype.temp) == MU_NULL_PTR
+	) {
+		mu_print("[MUB] Failed to set variable data; memory address location is out of range.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	mu_memcpy(location, data, variable.datatype.byte_size);
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+}
+
+MUDEF void mu_context_set_external_function(muResult* result, muContext* context, const char* name, void(*function)(muContext* context)) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to set external function; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	size_m index = 0;
+	if (mub_name_table_find(&context->program->external_function_name_table, name, &index) == MU_TRUE) {
+		context->external_functions[index] = (void(*)(void* context))function;
+		if (result != MU_NULL_PTR) {
+			*result = MU_SUCCESS;
+		}
+		return;
+	}
+	mu_print("[MUB] Failed to set external function; no external function with the given name could be found specified within the bytecode.\n");
+	if (result != MU_NULL_PTR) {
+		*result = MU_FAILURE;
+	}
+}
+
+// binds every name that can be found and gives how many were, failing if any couldn't be
+MUDEF size_m mu_context_set_external_functions(muResult* result, muContext* context, const muExternalFunctionBinding* bindings, size_m binding_len) {
+	if (context->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to set external functions; given context is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+	size_m bound_len = 0;
+	for (size_m i = 0; i < binding_len; i++) {
+		size_m index = 0;
+		if (mub_name_table_find(&context->program->external_function_name_table, bindings[i].name, &index) == MU_TRUE) {
+			context->external_functions[index] = (void(*)(void* context))bindings[i].function;
+			bound_len++;
+		}
+	}
+	if (bound_len != binding_len) {
+		mu_print("[MUB] Failed to set external functions; not every given name could be found specified within the bytecode.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return bound_len;
+	}
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return bound_len;
+}
+
+// context pool
+
+// the most contexts a pool can hold, as indexes + 1 need to fit in the low 32 bits of the pool's head
+#define MUB_CONTEXT_POOL_MAX_LEN 0x7FFFFFFF
+
+// the pool is allocated with the program's allocator if none is given
+muContextPool mub_context_pool_create(muResult* result, muProgram* program, size_m context_len, const muAllocator* allocator) {
+	muContextPool pool = {0};
+	pool.alive = MU_FALSE;
+
+	if (program == MU_NULL_PTR || program->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to create context pool; given program is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return pool;
+	}
+	if (context_len == 0 || context_len > MUB_CONTEXT_POOL_MAX_LEN) {
+		mu_print("[MUB] Failed to create context pool; invalid amount of contexts.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return pool;
+	}
+
+	pool.program = program;
+	pool.allocator = (allocator == MU_NULL_PTR) ? program->allocator : *allocator;
+	pool.contexts = mub_allocate(&pool.allocator, sizeof(mubPooledContext) * context_len);
+	pool.next = mub_allocate(&pool.allocator, sizeof(long) * context_len);
+	if (pool.contexts == MU_NULL_PTR || pool.next == MU_NULL_PTR) {
+		mu_print("[MUB] Failed to create context pool; malloc call failed.\n");
+		pool = mu_context_pool_destroy(MU_NULL_PTR, pool);
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return pool;
+	}
+	mu_memset(pool.contexts, 0, sizeof(mubPooledContext) * context_len);
+
+	// every context is created up front, so acquiring one never allocates
+	for (size_m i = 0; i < context_len; i++) {
+		muResult res = MU_SUCCESS;
+		pool.contexts[i].context = mu_context_create_from_program_with_allocator(&res, program, &pool.allocator);
+		pool.context_len = i + 1;
+		if (res != MU_SUCCESS) {
+			pool = mu_context_pool_destroy(MU_NULL_PTR, pool);
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
 			}
-		} break;
-		case MUB_OPERATION_COND_GREATER: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) > *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) > *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) > *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) > *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) > *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) > *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) > *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) > *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) > *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) > *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			return pool;
+		}
+		pool.next[i] = (i + 1 < context_len) ? (long)(i + 2) : 0;
+	}
+	pool.head = 1;
+
+	pool.alive = MU_TRUE;
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return pool;
+}
+
+MUDEF muContextPool mu_context_pool_create(muResult* result, muProgram* program, size_m context_len) {
+	return mub_context_pool_create(result, program, context_len, MU_NULL_PTR);
+}
+
+MUDEF muContextPool mu_context_pool_create_with_allocator(muResult* result, muProgram* program, size_m context_len, const muAllocator* allocator) {
+	return mub_context_pool_create(result, program, context_len, allocator);
+}
+
+// every context should be released before the pool is destroyed
+MUDEF muContextPool mu_context_pool_destroy(muResult* result, muContextPool pool) {
+	if (pool.contexts != MU_NULL_PTR) {
+		for (size_m i = 0; i < pool.context_len; i++) {
+			pool.contexts[i].context = mu_context_destroy(MU_NULL_PTR, pool.contexts[i].context);
+		}
+		mub_deallocate(&pool.allocator, pool.contexts);
+		pool.contexts = MU_NULL_PTR;
+		pool.context_len = 0;
+	}
+
+	if (pool.next != MU_NULL_PTR) {
+		mub_deallocate(&pool.allocator, pool.next);
+		pool.next = MU_NULL_PTR;
+	}
+
+	pool.program = MU_NULL_PTR;
+	pool.head = 0;
+	pool.alive = MU_FALSE;
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+	return pool;
+}
+
+// not thread-safe; meant to be called once after creating the pool, as resetting contexts keeps their external functions
+MUDEF size_m mu_context_pool_set_external_functions(muResult* result, muContextPool* pool, const muExternalFunctionBinding* bindings, size_m binding_len) {
+	if (pool->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to set external functions; given context pool is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return 0;
+	}
+
+	// every context shares the program, so each one binds the same names
+	muResult res = MU_SUCCESS;
+	size_m bound_len = 0;
+	for (size_m i = 0; i < pool->context_len; i++) {
+		bound_len = mu_context_set_external_functions(&res, &pool->contexts[i].context, bindings, binding_len);
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = res;
+	}
+	return bound_len;
+}
+
+// pops the first free context off the pool's list
+MUDEF muContext* mu_context_pool_acquire(muResult* result, muContextPool* pool) {
+	if (pool->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to acquire context; given context pool is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return MU_NULL_PTR;
+	}
+
+	while (MU_TRUE) {
+		int64_m head = MUB_ATOMIC_LOAD64(&pool->head);
+		long first = (long)(head & 0xFFFFFFFF);
+		if (first == 0) {
+			mu_print("[MUB] Failed to acquire context; every context in the pool is in use.\n");
+			if (result != MU_NULL_PTR) {
+				*result = MU_FAILURE;
 			}
-		} break;
-		case MUB_OPERATION_COND_GREATER_EQUAL: {
-			switch (src0_dt.byte_size) { default: break;
-				case 1: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint8_m*)&context->reg0[0]) >= *((uint8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int8_m*)&context->reg0[0]) >= *((int8_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 2: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint16_m*)&context->reg0[0]) >= *((uint16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int16_m*)&context->reg0[0]) >= *((int16_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 4: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint32_m*)&context->reg0[0]) >= *((uint32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int32_m*)&context->reg0[0]) >= *((int32_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((float*)&context->reg0[0]) >= *((float*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
-				case 8: {
-					switch (dst_dt.byte_size) { default: break;
-						case 1: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint8_m*)mem_loc) = (uint8_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int8_m*)mem_loc) = (int8_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 2: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint16_m*)mem_loc) = (uint16_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int16_m*)mem_loc) = (int16_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 4: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint32_m*)mem_loc) = (uint32_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int32_m*)mem_loc) = (int32_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((float*)mem_loc) = (float)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-						case 8: {
-							switch (src0_dt.type) { default: break;
-								case MUB_DATA_TYPE_INTEGER: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_UNSIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((uint64_m*)&context->reg0[0]) >= *((uint64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((int64_m*)&context->reg0[0]) >= *((int64_m*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-								case MUB_DATA_TYPE_DECIMAL: {
-									switch (dst_dt.type) { default: break;
-										case MUB_DATA_TYPE_INTEGER: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_UNSIGNED: { *((uint64_m*)mem_loc) = (uint64_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-														case MUB_DATA_TYPE_SIGNED:   { *((int64_m*)mem_loc) = (int64_m)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-										case MUB_DATA_TYPE_DECIMAL: {
-											switch (src0_dt.sign) { default: break;
-												case MUB_DATA_TYPE_SIGNED: {
-													switch (dst_dt.sign) { default: break;
-														case MUB_DATA_TYPE_SIGNED:   { *((double*)mem_loc) = (double)(*((double*)&context->reg0[0]) >= *((double*)&context->reg1[0])); return MU_SUCCESS; } break;
-													}
-												} break;
-											}
-										} break;
-									}
-								} break;
-							}
-						} break;
-					}
-				} break;
+			return MU_NULL_PTR;
+		}
+
+		// another thread may acquire and release the first context before this swap, which the acquire count catches
+		long next = MUB_ATOMIC_LOAD(&pool->next[first - 1]);
+		int64_m new_head = (int64_m)(((((uint64_m)head >> 32) + 1) << 32) | (uint64_m)next);
+		if (MUB_ATOMIC_CAS64(&pool->head, head, new_head)) {
+			MUB_ATOMIC_STORE(&pool->contexts[first - 1].in_use, 1);
+			if (result != MU_NULL_PTR) {
+				*result = MU_SUCCESS;
 			}
-		} break;
+			return &pool->contexts[first - 1].context;
+		}
 	}
+}
 
-	mu_print("[MUB] Failed to perform operation; invalid conversion request.\n");
-	return MU_FAILURE;
+// resets the context and pushes it back onto the pool's list
+MUDEF void mu_context_pool_release(muResult* result, muContextPool* pool, muContext* context) {
+	if (pool->alive == MU_FALSE) {
+		mu_print("[MUB] Failed to release context; given context pool is not valid.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+
+	size_m index = ((muByte*)context - (muByte*)pool->contexts) / sizeof(mubPooledContext);
+	if ((muByte*)context < (muByte*)pool->contexts || index >= pool->context_len || context != &pool->contexts[index].context) {
+		mu_print("[MUB] Failed to release context; given context isn't from this context pool.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+	// pushing a context that's already on the list would link it to itself, handing it out twice
+	if (MUB_ATOMIC_CAS(&pool->contexts[index].in_use, 1, 0) == 0) {
+		mu_print("[MUB] Failed to release context; given context isn't acquired.\n");
+		if (result != MU_NULL_PTR) {
+			*result = MU_FAILURE;
+		}
+		return;
+	}
+
+	mu_context_reset(MU_NULL_PTR, context);
+
+	while (MU_TRUE) {
+		int64_m head = MUB_ATOMIC_LOAD64(&pool->head);
+		MUB_ATOMIC_STORE(&pool->next[index], (long)(head & 0xFFFFFFFF));
+		int64_m new_head = (int64_m)(((uint64_m)head & 0xFFFFFFFF00000000) | (uint64_m)(index + 1));
+		if (MUB_ATOMIC_CAS64(&pool->head, head, new_head)) {
+			break;
+		}
+	}
+
+	if (result != MU_NULL_PTR) {
+		*result = MU_SUCCESS;
+	}
+}
+
+MUDEF muByte mu_string_to_binary(const char* s) {
+	muByte i = 0;
+	while (*s) {
+		i <<= 1;
+		i += *s++ - '0';
+	}
+	return i;
+}
+
+// operation kernels
+
+// every operation is generated once per source/destination type pair that it supports. types are
+// ordered integers first, then signed decimals, then unsigned decimals (which are operated on as
+// signed), so the types an operation supports are always the first ones in the list
+
+#define MUB_KERNEL_INTEGER_TYPE_COUNT    8
+#define MUB_KERNEL_ARITHMETIC_TYPE_COUNT 10
+#define MUB_KERNEL_TYPE_COUNT            12
+
+#define MUB_SOURCE_INTEGER_TYPES(X, a, b) \
+	X(a, b, uint8_m, u8) X(a, b, int8_m, i8) X(a, b, uint16_m, u16) X(a, b, int16_m, i16) \
+	X(a, b, uint32_m, u32) X(a, b, int32_m, i32) X(a, b, uint64_m, u64) X(a, b, int64_m, i64)
+#define MUB_SOURCE_ARITHMETIC_TYPES(X, a, b) MUB_SOURCE_INTEGER_TYPES(X, a, b) X(a, b, float, f32) X(a, b, double, f64)
+#define MUB_SOURCE_TYPES(X, a, b) MUB_SOURCE_ARITHMETIC_TYPES(X, a, b) X(a, b, float, uf32) X(a, b, double, uf64)
+
+#define MUB_DESTINATION_INTEGER_TYPES(X, a, b, c) \
+	X(a, b, c, uint8_m, u8) X(a, b, c, int8_m, i8) X(a, b, c, uint16_m, u16) X(a, b, c, int16_m, i16) \
+	X(a, b, c, uint32_m, u32) X(a, b, c, int32_m, i32) X(a, b, c, uint64_m, u64) X(a, b, c, int64_m, i64)
+#define MUB_DESTINATION_ARITHMETIC_TYPES(X, a, b, c) MUB_DESTINATION_INTEGER_TYPES(X, a, b, c) X(a, b, c, float, f32) X(a, b, c, double, f64)
+#define MUB_DESTINATION_TYPES(X, a, b, c) MUB_DESTINATION_ARITHMETIC_TYPES(X, a, b, c) X(a, b, c, float, uf32) X(a, b, c, double, uf64)
+
+#define MUB_KERNEL_EXPRESSION_MOVE(type)                (*((type*)reg0))
+#define MUB_KERNEL_EXPRESSION_ADD(type)                 (*((type*)reg0) +  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_SUBTRACT(type)            (*((type*)reg0) -  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_MULTIPLY(type)            (*((type*)reg0) *  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_DIVIDE(type)              (*((type*)reg0) /  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_MODULO(type)              (*((type*)reg0) %  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_BW_NOT(type)              (~*((type*)reg0))
+#define MUB_KERNEL_EXPRESSION_BW_AND(type)              (*((type*)reg0) &  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_BW_OR(type)               (*((type*)reg0) |  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_BW_XOR(type)              (*((type*)reg0) ^  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_BW_LSHIFT(type)           (*((type*)reg0) << *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_BW_RSHIFT(type)           (*((type*)reg0) >> *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_EQUAL(type)          (*((type*)reg0) == *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_NOT_EQUAL(type)      (*((type*)reg0) != *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_LESS(type)           (*((type*)reg0) <  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_LESS_EQUAL(type)     (*((type*)reg0) <= *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_GREATER(type)        (*((type*)reg0) >  *((type*)reg1))
+#define MUB_KERNEL_EXPRESSION_COND_GREATER_EQUAL(type)  (*((type*)reg0) >= *((type*)reg1))
+
+#define MUB_DEFINE_KERNEL(operation, src_type, src_name, dst_type, dst_name) \
+	static void mub_kernel_##operation##_##src_name##_##dst_name(muByte* mem_loc, muByte* reg0, muByte* reg1) { \
+		(void)reg1; \
+		*((dst_type*)mem_loc) = (dst_type)MUB_KERNEL_EXPRESSION_##operation(src_type); \
+	}
+#define MUB_DEFINE_SOURCE_KERNELS(operation, destination_types, src_type, src_name) \
+	destination_types(MUB_DEFINE_KERNEL, operation, src_type, src_name)
+
+#define MUB_KERNEL_NAME(operation, src_type, src_name, dst_type, dst_name) mub_kernel_##operation##_##src_name##_##dst_name,
+#define MUB_SOURCE_KERNEL_NAMES(operation, destination_types, src_type, src_name) \
+	{ destination_types(MUB_KERNEL_NAME, operation, src_type, src_name) },
+
+// defines every kernel of an operation and a table of them indexed by source and destination type
+#define MUB_DEFINE_KERNELS(operation, source_types, destination_types, src_count, dst_count) \
+	source_types(MUB_DEFINE_SOURCE_KERNELS, operation, destination_types) \
+	static const mubOperationKernel mub_kernels_##operation[src_count][dst_count] = { \
+		source_types(MUB_SOURCE_KERNEL_NAMES, operation, destination_types) \
+	};
+
+MUB_DEFINE_KERNELS(MOVE, MUB_SOURCE_TYPES, MUB_DESTINATION_TYPES, MUB_KERNEL_TYPE_COUNT, MUB_KERNEL_TYPE_COUNT)
+MUB_DEFINE_KERNELS(ADD, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(SUBTRACT, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(MULTIPLY, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(DIVIDE, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+
+#ifndef MUB_SHORT_OPERATION_LIST
+MUB_DEFINE_KERNELS(MODULO, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_NOT, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_AND, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_OR, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_XOR, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_LSHIFT, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(BW_RSHIFT, MUB_SOURCE_INTEGER_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_EQUAL, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_NOT_EQUAL, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_LESS, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_LESS_EQUAL, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_GREATER, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+MUB_DEFINE_KERNELS(COND_GREATER_EQUAL, MUB_SOURCE_ARITHMETIC_TYPES, MUB_DESTINATION_ARITHMETIC_TYPES, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+#endif
+
+int mub_get_kernel_type_index(mubDataType dt) {
+	if (dt.type == MUB_DATA_TYPE_INTEGER) {
+		switch (dt.byte_size) { default: break;
+			case 1: return 0 + dt.sign; break;
+			case 2: return 2 + dt.sign; break;
+			case 4: return 4 + dt.sign; break;
+			case 8: return 6 + dt.sign; break;
+		}
+	} else if (dt.type == MUB_DATA_TYPE_DECIMAL) {
+		switch (dt.byte_size) { default: break;
+			case 4: return (dt.sign == MUB_DATA_TYPE_SIGNED) ? 8 : 10; break;
+			case 8: return (dt.sign == MUB_DATA_TYPE_SIGNED) ? 9 : 11; break;
+		}
+	}
+	return -1;
+}
+
+#define MUB_FIND_KERNEL(operation, src_count, dst_count) \
+	if (src < src_count && dst < dst_count) { return mub_kernels_##operation[src][dst]; } break;
+
+// the kernel performing an operation between the given types, or 0 if the conversion isn't supported
+mubOperationKernel mub_get_operation_kernel(int operation, mubDataType src_dt, mubDataType dst_dt) {
+	int src = mub_get_kernel_type_index(src_dt);
+	int dst = mub_get_kernel_type_index(dst_dt);
+	if (src < 0 || dst < 0) {
+		return MU_NULL_PTR;
+	}
+
+	switch (operation) { default: break;
+		case MUB_OPERATION_MOVE:               MUB_FIND_KERNEL(MOVE, MUB_KERNEL_TYPE_COUNT, MUB_KERNEL_TYPE_COUNT)
+		case MUB_OPERATION_ADD:                MUB_FIND_KERNEL(ADD, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_SUBTRACT:           MUB_FIND_KERNEL(SUBTRACT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_MULTIPLY:           MUB_FIND_KERNEL(MULTIPLY, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_DIVIDE:             MUB_FIND_KERNEL(DIVIDE, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+#ifndef MUB_SHORT_OPERATION_LIST
+		case MUB_OPERATION_MODULO:             MUB_FIND_KERNEL(MODULO, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_BW_NOT:             MUB_FIND_KERNEL(BW_NOT, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_TYPE_COUNT)
+		case MUB_OPERATION_BW_AND:             MUB_FIND_KERNEL(BW_AND, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_BW_OR:              MUB_FIND_KERNEL(BW_OR, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_BW_XOR:             MUB_FIND_KERNEL(BW_XOR, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_BW_LSHIFT:          MUB_FIND_KERNEL(BW_LSHIFT, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_BW_RSHIFT:          MUB_FIND_KERNEL(BW_RSHIFT, MUB_KERNEL_INTEGER_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_EQUAL:         MUB_FIND_KERNEL(COND_EQUAL, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_NOT_EQUAL:     MUB_FIND_KERNEL(COND_NOT_EQUAL, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_LESS:          MUB_FIND_KERNEL(COND_LESS, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_LESS_EQUAL:    MUB_FIND_KERNEL(COND_LESS_EQUAL, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_GREATER:       MUB_FIND_KERNEL(COND_GREATER, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+		case MUB_OPERATION_COND_GREATER_EQUAL: MUB_FIND_KERNEL(COND_GREATER_EQUAL, MUB_KERNEL_ARITHMETIC_TYPE_COUNT, MUB_KERNEL_ARITHMETIC_TYPE_COUNT)
+#endif
+	}
+	return MU_NULL_PTR;
 }
 
+#undef MUB_FIND_KERNEL
+
 #ifdef __cplusplus
 	}
 #endif